@@ -0,0 +1,187 @@
+// Copyright 2025 Nguyen Phi Hung. All Rights Reserved.
+#include "ColumnarTagValueRepository.h"
+#include "TagValueVariant.h"
+
+FColumnarTagValueRepository::FColumnarTagValueRepository(const FName& InName, int32 InPriority)
+    : RepositoryName(InName)
+    , Priority(InPriority)
+{
+    EnableMembershipFilter();
+}
+
+bool FColumnarTagValueRepository::HasValue(FGameplayTag Tag) const
+{
+    return Index.Contains(Tag);
+}
+
+TSharedPtr<ITagValueHolder> FColumnarTagValueRepository::GetValue(FGameplayTag Tag) const
+{
+    // Compatibility path: box the column value into a holder
+    FTagValueVariant Value;
+    return TryGetRaw(Tag, Value) ? Value.ToHolder() : nullptr;
+}
+
+bool FColumnarTagValueRepository::TryGetRaw(FGameplayTag Tag, FTagValueVariant& OutValue) const
+{
+    const FValueSlot* Slot = Index.Find(Tag);
+    if (!Slot)
+    {
+        OutValue.Reset();
+        return false;
+    }
+    
+    // Read straight from the column the index points at
+    switch (Slot->Type)
+    {
+    case ETagValueType::Bool:
+        OutValue.SetBool(Bools[Slot->Slot]);
+        break;
+    case ETagValueType::Int:
+        OutValue.SetInt(Ints[Slot->Slot]);
+        break;
+    case ETagValueType::Float:
+        OutValue.SetFloat(Floats[Slot->Slot]);
+        break;
+    case ETagValueType::String:
+        OutValue.SetBoxed<FStringTagValue>(Strings[Slot->Slot]);
+        break;
+    case ETagValueType::Transform:
+        OutValue.SetBoxed<FTransformTagValue>(Transforms[Slot->Slot]);
+        break;
+    case ETagValueType::Class:
+        OutValue.SetBoxed<FClassTagValue>(Classes[Slot->Slot]);
+        break;
+    case ETagValueType::Object:
+        OutValue.SetBoxed<FObjectTagValue>(Objects[Slot->Slot]);
+        break;
+    default:
+        OutValue.Reset();
+        break;
+    }
+    return OutValue.IsSet();
+}
+
+void FColumnarTagValueRepository::SetValue(FGameplayTag Tag, TSharedPtr<ITagValueHolder> Value)
+{
+    if (!Tag.IsValid() || !Value.IsValid() || !Value->IsValid())
+    {
+        return;
+    }
+    
+    // Unbox the holder into the matching column
+    void* ValuePtr = Value->GetValuePtr();
+    
+    switch (Value->GetValueTypeId())
+    {
+    case ETagValueType::Bool:
+        SetTypedValue(Tag, static_cast<FBoolTagValue*>(ValuePtr)->Value);
+        break;
+    case ETagValueType::Int:
+        SetTypedValue(Tag, static_cast<FIntTagValue*>(ValuePtr)->Value);
+        break;
+    case ETagValueType::Float:
+        SetTypedValue(Tag, static_cast<FFloatTagValue*>(ValuePtr)->Value);
+        break;
+    case ETagValueType::String:
+        SetTypedValue(Tag, static_cast<FStringTagValue*>(ValuePtr)->Value);
+        break;
+    case ETagValueType::Transform:
+        SetTypedValue(Tag, static_cast<FTransformTagValue*>(ValuePtr)->Value);
+        break;
+    case ETagValueType::Class:
+        SetTypedValue(Tag, static_cast<FClassTagValue*>(ValuePtr)->Value);
+        break;
+    case ETagValueType::Object:
+        SetTypedValue(Tag, static_cast<FObjectTagValue*>(ValuePtr)->Value);
+        break;
+    default:
+        break;
+    }
+}
+
+void FColumnarTagValueRepository::RemoveValue(FGameplayTag Tag)
+{
+    FValueSlot Slot;
+    if (Index.RemoveAndCopyValue(Tag, Slot))
+    {
+        RemoveFromColumn(Slot.Type, Slot.Slot);
+        MarkTagAbsent(Tag);
+        BumpGeneration();
+    }
+}
+
+void FColumnarTagValueRepository::RemoveFromColumn(ETagValueType Type, int32 Slot)
+{
+    // Swap the last slot into the hole so the column stays contiguous
+    switch (Type)
+    {
+    case ETagValueType::Bool:
+        Bools[Slot] = static_cast<bool>(Bools[Bools.Num() - 1]);
+        Bools.RemoveAt(Bools.Num() - 1);
+        break;
+    case ETagValueType::Int:
+        Ints.RemoveAtSwap(Slot);
+        break;
+    case ETagValueType::Float:
+        Floats.RemoveAtSwap(Slot);
+        break;
+    case ETagValueType::String:
+        Strings.RemoveAtSwap(Slot);
+        break;
+    case ETagValueType::Transform:
+        Transforms.RemoveAtSwap(Slot);
+        break;
+    case ETagValueType::Class:
+        Classes.RemoveAtSwap(Slot);
+        break;
+    case ETagValueType::Object:
+        Objects.RemoveAtSwap(Slot);
+        break;
+    }
+    
+    TArray<FGameplayTag>& Tags = ColumnTags[static_cast<int32>(Type)];
+    Tags.RemoveAtSwap(Slot);
+    
+    // Patch the index entry of the value that moved into the hole
+    if (Tags.IsValidIndex(Slot))
+    {
+        Index.FindChecked(Tags[Slot]).Slot = Slot;
+    }
+}
+
+void FColumnarTagValueRepository::ClearAllValues()
+{
+    Index.Empty();
+    for (TArray<FGameplayTag>& Tags : ColumnTags)
+    {
+        Tags.Empty();
+    }
+    
+    Bools.Empty();
+    Ints.Empty();
+    Floats.Empty();
+    Strings.Empty();
+    Transforms.Empty();
+    Classes.Empty();
+    Objects.Empty();
+    
+    ResetMembership();
+    BumpGeneration();
+}
+
+TArray<FGameplayTag> FColumnarTagValueRepository::GetAllTags() const
+{
+    TArray<FGameplayTag> Result;
+    Index.GetKeys(Result);
+    return Result;
+}
+
+FName FColumnarTagValueRepository::GetRepositoryName() const
+{
+    return RepositoryName;
+}
+
+int32 FColumnarTagValueRepository::GetPriority() const
+{
+    return Priority;
+}
@@ -33,6 +33,9 @@ int32 UGameplayTagValueDataAsset::RegisterToSubsystem(UGameplayTagValueSubsystem
     // If we have a valid subsystem, register all data tables
     if (Subsystem)
     {
+        // Apply all rows together and notify listeners once
+        FTagValueWriteBatch WriteBatch(Subsystem);
+        
         for (UDataTable* DataTable : DataTables)
         {
             if (DataTable)
@@ -78,6 +81,8 @@ int32 UGameplayTagValueDataAsset::RegisterToSubsystem(UGameplayTagValueSubsystem
                             case ETagValueType::Object:
                                 bSuccess = Subsystem->SetObjectValue(Row->Tag, Row->ObjectValue, RepositoryName);
                                 break;
+                            default:
+                                break;
                             }
                             
                             if (bSuccess)
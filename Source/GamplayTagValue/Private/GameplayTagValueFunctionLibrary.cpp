@@ -34,8 +34,9 @@ bool UGameplayTagValueFunctionLibrary::GetBoolTagValue(const UObject* WorldConte
         return DefaultValue;
     }
     
-    bSuccess = Subsystem->HasTagValue(Tag, Context);
-    return Subsystem->GetBoolValue(Tag, DefaultValue, Context);
+    bool Result = DefaultValue;
+    bSuccess = Subsystem->TryGetBoolValue(Tag, Result, Context);
+    return Result;
 }
 
 bool UGameplayTagValueFunctionLibrary::SetBoolTagValue(const UObject* WorldContextObject, FGameplayTag Tag, bool Value, FName RepositoryName)
@@ -58,8 +59,9 @@ int32 UGameplayTagValueFunctionLibrary::GetIntTagValue(const UObject* WorldConte
         return DefaultValue;
     }
     
-    bSuccess = Subsystem->HasTagValue(Tag, Context);
-    return Subsystem->GetIntValue(Tag, DefaultValue, Context);
+    int32 Result = DefaultValue;
+    bSuccess = Subsystem->TryGetIntValue(Tag, Result, Context);
+    return Result;
 }
 
 bool UGameplayTagValueFunctionLibrary::SetIntTagValue(const UObject* WorldContextObject, FGameplayTag Tag, int32 Value, FName RepositoryName)
@@ -82,8 +84,9 @@ float UGameplayTagValueFunctionLibrary::GetFloatTagValue(const UObject* WorldCon
         return DefaultValue;
     }
     
-    bSuccess = Subsystem->HasTagValue(Tag, Context);
-    return Subsystem->GetFloatValue(Tag, DefaultValue, Context);
+    float Result = DefaultValue;
+    bSuccess = Subsystem->TryGetFloatValue(Tag, Result, Context);
+    return Result;
 }
 
 bool UGameplayTagValueFunctionLibrary::SetFloatTagValue(const UObject* WorldContextObject, FGameplayTag Tag, float Value, FName RepositoryName)
@@ -106,8 +109,9 @@ FString UGameplayTagValueFunctionLibrary::GetStringTagValue(const UObject* World
         return DefaultValue;
     }
     
-    bSuccess = Subsystem->HasTagValue(Tag, Context);
-    return Subsystem->GetStringValue(Tag, DefaultValue, Context);
+    FString Result = DefaultValue;
+    bSuccess = Subsystem->TryGetStringValue(Tag, Result, Context);
+    return Result;
 }
 
 bool UGameplayTagValueFunctionLibrary::SetStringTagValue(const UObject* WorldContextObject, FGameplayTag Tag, const FString& Value, FName RepositoryName)
@@ -130,8 +134,9 @@ FTransform UGameplayTagValueFunctionLibrary::GetTransformTagValue(const UObject*
         return DefaultValue;
     }
     
-    bSuccess = Subsystem->HasTagValue(Tag, Context);
-    return Subsystem->GetTransformValue(Tag, DefaultValue, Context);
+    FTransform Result = DefaultValue;
+    bSuccess = Subsystem->TryGetTransformValue(Tag, Result, Context);
+    return Result;
 }
 
 bool UGameplayTagValueFunctionLibrary::SetTransformTagValue(const UObject* WorldContextObject, FGameplayTag Tag, const FTransform& Value, FName RepositoryName)
@@ -154,8 +159,9 @@ TSoftClassPtr<UObject> UGameplayTagValueFunctionLibrary::GetClassTagValue(const
         return DefaultValue;
     }
     
-    bSuccess = Subsystem->HasTagValue(Tag, Context);
-    return Subsystem->GetClassValue(Tag, DefaultValue, Context);
+    TSoftClassPtr<UObject> Result = DefaultValue;
+    bSuccess = Subsystem->TryGetClassValue(Tag, Result, Context);
+    return Result;
 }
 
 bool UGameplayTagValueFunctionLibrary::SetClassTagValue(const UObject* WorldContextObject, FGameplayTag Tag, TSoftClassPtr<UObject> Value, FName RepositoryName)
@@ -178,8 +184,9 @@ TSoftObjectPtr<UObject> UGameplayTagValueFunctionLibrary::GetObjectTagValue(cons
         return DefaultValue;
     }
     
-    bSuccess = Subsystem->HasTagValue(Tag, Context);
-    return Subsystem->GetObjectValue(Tag, DefaultValue, Context);
+    TSoftObjectPtr<UObject> Result = DefaultValue;
+    bSuccess = Subsystem->TryGetObjectValue(Tag, Result, Context);
+    return Result;
 }
 
 bool UGameplayTagValueFunctionLibrary::SetObjectTagValue(const UObject* WorldContextObject, FGameplayTag Tag, TSoftObjectPtr<UObject> Value, FName RepositoryName)
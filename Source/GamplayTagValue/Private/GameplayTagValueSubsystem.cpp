@@ -1,8 +1,16 @@
 // Copyright 2025 Nguyen Phi Hung. All Rights Reserved.
 #include "GameplayTagValueSubsystem.h"
+#include "ColumnarTagValueRepository.h"
 #include "Engine/DataTable.h"
 #include "GameplayTagValueDataAsset.h"
+#include "GameplayTagsModule.h"
+#include "IndexedTagValueRepository.h"
+#include "TagValueHandle.h"
 #include "Kismet/GameplayStatics.h"
+#include "Misc/CoreDelegates.h"
+#include "ShardedTagValueRepository.h"
+#include "SnapshotTagValueRepository.h"
+#include "VersionedTagValueRepository.h"
 
 // Static member initialization
 const FName UGameplayTagValueSubsystem::DefaultRepositoryName = TEXT("Default");
@@ -15,6 +23,7 @@ FMemoryTagValueRepository::FMemoryTagValueRepository(const FName& InName, int32
     : RepositoryName(InName)
     , Priority(InPriority)
 {
+    EnableMembershipFilter();
 }
 
 bool FMemoryTagValueRepository::HasValue(FGameplayTag Tag) const
@@ -24,32 +33,77 @@ bool FMemoryTagValueRepository::HasValue(FGameplayTag Tag) const
 
 TSharedPtr<ITagValueHolder> FMemoryTagValueRepository::GetValue(FGameplayTag Tag) const
 {
-    const TSharedPtr<ITagValueHolder>* ValuePtr = TagValues.Find(Tag);
-    return ValuePtr ? *ValuePtr : nullptr;
+    const TSharedPtr<ITagValueHolder>* Value = TagValues.Find(Tag);
+    return Value ? *Value : nullptr;
+}
+
+bool FMemoryTagValueRepository::TryGetRaw(FGameplayTag Tag, FTagValueVariant& OutValue) const
+{
+    const TSharedPtr<ITagValueHolder>* Value = TagValues.Find(Tag);
+    OutValue = Value ? FTagValueVariant::FromHolder(*Value) : FTagValueVariant();
+    return OutValue.IsSet();
 }
 
 void FMemoryTagValueRepository::SetValue(FGameplayTag Tag, TSharedPtr<ITagValueHolder> Value)
 {
     if (Tag.IsValid() && Value.IsValid())
     {
-        TagValues.Add(Tag, Value);
+        ReleaseClearedValues();
+        
+        TSharedPtr<ITagValueHolder>& Entry = TagValues.FindOrAdd(Tag);
+        const bool bWasPresent = Entry.IsValid();
+        Entry = MoveTemp(Value);
+        if (!bWasPresent)
+        {
+            MarkTagPresent(Tag);
+        }
+        BumpGeneration();
     }
 }
 
 void FMemoryTagValueRepository::RemoveValue(FGameplayTag Tag)
 {
-    TagValues.Remove(Tag);
+    ReleaseClearedValues();
+    
+    if (TagValues.Remove(Tag) > 0)
+    {
+        MarkTagAbsent(Tag);
+        BumpGeneration();
+    }
 }
 
 void FMemoryTagValueRepository::ClearAllValues()
 {
-    TagValues.Empty();
+    // Move the map aside rather than freeing every value now; any write since the last clear freed the previous one
+    if (!TagValues.IsEmpty())
+    {
+        ClearedValues = MoveTemp(TagValues);
+        TagValues.Reset();
+    }
+    ResetMembership();
+    BumpGeneration();
+}
+
+TSharedPtr<ITagValueRepository> FMemoryTagValueRepository::DetachAllValues()
+{
+    // The map and its membership filter change owner; nothing is copied
+    TSharedPtr<FMemoryTagValueRepository> Detached = MakeShared<FMemoryTagValueRepository>(RepositoryName, Priority);
+    Detached->TagValues = MoveTemp(TagValues);
+    TagValues.Reset();
+    HandOverMembership(*Detached);
+    BumpGeneration();
+    return Detached;
+}
+
+void FMemoryTagValueRepository::ReleaseClearedValues()
+{
+    ClearedValues.Empty();
 }
 
 TArray<FGameplayTag> FMemoryTagValueRepository::GetAllTags() const
 {
     TArray<FGameplayTag> Result;
-    TagValues.GetKeys(Result);
+    TagValues.GenerateKeyArray(Result);
     return Result;
 }
 
@@ -67,177 +121,1128 @@ int32 FMemoryTagValueRepository::GetPriority() const
 // UGameplayTagValueSubsystem Implementation
 //------------------------------------------------------------------------------
 
-void UGameplayTagValueSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+void UGameplayTagValueSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+    
+    // Precompute ancestor chains so hierarchical lookups do not go through the tag manager
+    AncestorTable.Rebuild();
+    Subscriptions.SetAncestorTable(&AncestorTable);
+    TagTreeChangedHandle = IGameplayTagsModule::OnGameplayTagTreeChanged.AddUObject(this, &UGameplayTagValueSubsystem::HandleTagTreeChanged);
+    
+    // Bound first, so writes queued from other threads are applied before end of frame dispatch and snapshots
+    QueuedWritesHandle = FCoreDelegates::OnEndFrame.AddUObject(this, &UGameplayTagValueSubsystem::DrainQueuedWrites);
+    
+    // Create the default repository
+    TSharedPtr<FMemoryTagValueRepository> DefaultRepository = MakeShared<FMemoryTagValueRepository>(DefaultRepositoryName, 100);
+    RegisterRepository(DefaultRepository);
+    
+    // Register any configured data assets
+    RegisterConfiguredDataAssets();
+}
+
+void UGameplayTagValueSubsystem::Deinitialize()
+{
+    // Clear all repositories; handles still bound to them must not touch them again
+    SortedRepositories.Empty();
+    Repositories.Empty();
+    ResolutionCache.Empty();
+    ++RepositoryLayoutGeneration;
+    
+    IGameplayTagsModule::OnGameplayTagTreeChanged.Remove(TagTreeChangedHandle);
+    TagTreeChangedHandle.Reset();
+    Subscriptions.SetAncestorTable(nullptr);
+    AncestorTable.Reset();
+    EffectiveValues.Empty();
+    bEffectiveValuesValid = false;
+    
+    if (EndOfFrameHandle.IsValid())
+    {
+        FCoreDelegates::OnEndFrame.Remove(EndOfFrameHandle);
+        EndOfFrameHandle.Reset();
+    }
+    
+    // The frame snapshot buffers are freed with the subsystem, as readers may still be in the front one
+    SetFrameSnapshotEnabled(false);
+    
+    FCoreDelegates::OnEndFrame.Remove(QueuedWritesHandle);
+    QueuedWritesHandle.Reset();
+    QueuedWrites.Empty();
+    
+    // Drop any batch that was left open and any undelivered changes
+    BatchDepth = 0;
+    StagedWrites.Empty();
+    PendingChangedTags.Reset();
+    PendingChanges.Empty();
+    PendingChangeIndex.Empty();
+    Subscriptions.Reset();
+    
+    Super::Deinitialize();
+}
+
+void UGameplayTagValueSubsystem::RegisterRepository(TSharedPtr<ITagValueRepository> Repository)
+{
+    if (!Repository.IsValid())
+    {
+        return;
+    }
+    
+    // Remove any existing repository with the same name
+    UnregisterRepository(Repository->GetRepositoryName());
+    
+    // Add the new repository
+    const uint64 StampBefore = GetRepositoryStamp();
+    Repositories.Add(Repository->GetRepositoryName(), Repository);
+    RebuildSortedRepositories();
+    HandleTagValuesChanged(StampBefore, Repository->GetAllTags());
+}
+
+bool UGameplayTagValueSubsystem::CreateRepository(FName RepositoryName, int32 Priority, ETagValueRepositoryStorage Storage)
+{
+    if (RepositoryName == NAME_None)
+    {
+        return false;
+    }
+    
+    TSharedPtr<ITagValueRepository> Repository = MakeMemoryRepository(RepositoryName, Priority, Storage);
+    if (!Repository.IsValid())
+    {
+        return false;
+    }
+    
+    RegisterRepository(Repository);
+    return true;
+}
+
+TSharedPtr<ITagValueRepository> UGameplayTagValueSubsystem::MakeMemoryRepository(FName RepositoryName, int32 Priority, ETagValueRepositoryStorage Storage)
+{
+    switch (Storage)
+    {
+    case ETagValueRepositoryStorage::Map:
+        return MakeShared<FMemoryTagValueRepository>(RepositoryName, Priority);
+    case ETagValueRepositoryStorage::Indexed:
+        return MakeShared<FIndexedTagValueRepository>(RepositoryName, Priority);
+    case ETagValueRepositoryStorage::Columnar:
+        return MakeShared<FColumnarTagValueRepository>(RepositoryName, Priority);
+    case ETagValueRepositoryStorage::Snapshot:
+        return MakeShared<FSnapshotTagValueRepository>(RepositoryName, Priority);
+    case ETagValueRepositoryStorage::Sharded:
+        return MakeShared<FShardedTagValueRepository>(RepositoryName, Priority);
+    case ETagValueRepositoryStorage::Versioned:
+        return MakeShared<FVersionedTagValueRepository>(RepositoryName, Priority);
+    default:
+        return nullptr;
+    }
+}
+
+void UGameplayTagValueSubsystem::UnregisterRepository(FName RepositoryName)
+{
+    const uint64 StampBefore = GetRepositoryStamp();
+    TSharedPtr<ITagValueRepository> Repository;
+    if (Repositories.RemoveAndCopyValue(RepositoryName, Repository))
+    {
+        RebuildSortedRepositories();
+        HandleTagValuesChanged(StampBefore, Repository->GetAllTags());
+    }
+}
+
+void UGameplayTagValueSubsystem::RebuildSortedRepositories()
+{
+    SortedRepositories.Reset(Repositories.Num());
+    for (const TPair<FName, TSharedPtr<ITagValueRepository>>& Pair : Repositories)
+    {
+        SortedRepositories.Add(Pair.Value.Get());
+    }
+    
+    // Sort by priority (highest first)
+    SortedRepositories.StableSort([](const ITagValueRepository& A, const ITagValueRepository& B)
+    {
+        return A.GetPriority() > B.GetPriority();
+    });
+    
+    // The priority order changed, so every cached resolution is stale, and their dependencies may be gone
+    ResolutionCache.Reset();
+    ++RepositoryLayoutGeneration;
+}
+
+void UGameplayTagValueSubsystem::HandleTagTreeChanged()
+{
+    AncestorTable.Rebuild();
+    bEffectiveValuesValid = false;
+    InvalidateFrameSnapshots();
+    
+    // Parents may have changed, so cached inherited values are stale
+    ResolutionCache.Reset();
+    ++RepositoryLayoutGeneration;
+}
+
+uint64 UGameplayTagValueSubsystem::GetRepositoryStamp() const
+{
+    // Generations only grow, so the sum changes on every write for as long as the layout is unchanged
+    uint32 Sum = 0;
+    for (const ITagValueRepository* Repository : SortedRepositories)
+    {
+        Sum += Repository->GetGeneration();
+    }
+    return (static_cast<uint64>(RepositoryLayoutGeneration) << 32) | Sum;
+}
+
+void UGameplayTagValueSubsystem::GatherDependencies(const FGameplayTag& Tag, const FTagValueResolution& Resolution, FTagValueRepositoryDependencies& OutDependencies) const
+{
+    OutDependencies.Reset();
+    const bool bExactHit = Resolution.Repository && Resolution.ResolvedTag == Tag;
+    for (const ITagValueRepository* Repository : SortedRepositories)
+    {
+        OutDependencies.Add(*Repository);
+        if (bExactHit && Repository == Resolution.Repository)
+        {
+            break;
+        }
+    }
+}
+
+UGameplayTagValueSubsystem::FTagValueResolution UGameplayTagValueSubsystem::ResolveTag(FGameplayTag Tag, int32 TagIndex) const
+{
+    if (bEffectiveValueTableEnabled)
+    {
+        if (TagIndex == INDEX_NONE)
+        {
+            TagIndex = FTagValueTagIndex::GetIndex(Tag);
+        }
+        if (const FTagValueResolution* Effective = FindEffectiveValue(Tag, TagIndex))
+        {
+            return *Effective;
+        }
+    }
+    
+    // An entry is only dropped once a repository it depends on was written to
+    if (const FCachedTagValueResolution* Cached = ResolutionCache.Find(Tag))
+    {
+        if (Cached->Dependencies.IsCurrent())
+        {
+            ++ResolutionCacheHits;
+            return Cached->Resolution;
+        }
+    }
+    
+    ++ResolutionCacheMisses;
+    
+    FTagValueResolution Resolution;
+    
+    // Ancestors walked on the way up resolve to the same value, so they are cached too
+    TArray<FGameplayTag, TInlineAllocator<8>> WalkedAncestors;
+    
+    // Repositories with nothing under the tag's root are skipped for the whole walk
+    const TArrayView<const FGameplayTag> Chain = TagIndex != INDEX_NONE ? AncestorTable.GetChain(Tag, TagIndex) : AncestorTable.GetChain(Tag);
+    const TArrayView<const int32> ChainIndices = AncestorTable.GetChainIndices(Chain);
+    FResolveCandidates Candidates;
+    GatherResolveCandidates(ChainIndices.IsEmpty() ? INDEX_NONE : ChainIndices.Last(), Candidates);
+    
+    // Returns true once the resolution is known
+    auto VisitTag = [this, &Tag, &Resolution, &WalkedAncestors, &Candidates](const FGameplayTag& CurrentTag, int32 CurrentIndex)
+    {
+        if (CurrentTag != Tag)
+        {
+            // Reuse the walk of a sibling or child that was resolved earlier
+            const FCachedTagValueResolution* CachedAncestor = ResolutionCache.Find(CurrentTag);
+            if (CachedAncestor && CachedAncestor->Dependencies.IsCurrent())
+            {
+                Resolution = CachedAncestor->Resolution;
+                return true;
+            }
+            WalkedAncestors.Add(CurrentTag);
+        }
+        
+        return FindInCandidates(CurrentTag, CurrentIndex, Candidates, Resolution);
+    };
+    
+    // Check the tag itself, then its parents (hierarchical inheritance)
+    if (!Chain.IsEmpty())
+    {
+        for (int32 ChainIndex = 0; ChainIndex < Chain.Num(); ++ChainIndex)
+        {
+            if (VisitTag(Chain[ChainIndex], ChainIndices[ChainIndex]))
+            {
+                break;
+            }
+        }
+    }
+    else
+    {
+        // Tags missing from the table walk the tag manager instead
+        for (FGameplayTag CurrentTag = Tag; CurrentTag.IsValid(); CurrentTag = CurrentTag.RequestDirectParent())
+        {
+            if (VisitTag(CurrentTag, INDEX_NONE))
+            {
+                break;
+            }
+        }
+    }
+    
+    for (const FGameplayTag& Ancestor : WalkedAncestors)
+    {
+        FCachedTagValueResolution& Entry = ResolutionCache.FindOrAdd(Ancestor);
+        Entry.Resolution = Resolution;
+        GatherDependencies(Ancestor, Resolution, Entry.Dependencies);
+    }
+    
+    FCachedTagValueResolution& Entry = ResolutionCache.FindOrAdd(Tag);
+    GatherDependencies(Tag, Resolution, Entry.Dependencies);
+    Entry.Resolution = Resolution;
+    return Resolution;
+}
+
+void UGameplayTagValueSubsystem::SetEffectiveValueTableEnabled(bool bEnabled)
+{
+    bEffectiveValueTableEnabled = bEnabled;
+    bEffectiveValuesValid = false;
+    if (!bEnabled)
+    {
+        EffectiveValues.Empty();
+    }
+}
+
+bool UGameplayTagValueSubsystem::IsEffectiveValueTableInSync(uint64 Stamp) const
+{
+    return bEffectiveValueTableEnabled && bEffectiveValuesValid && EffectiveValuesStamp == Stamp;
+}
+
+void UGameplayTagValueSubsystem::HandleTagValuesChanged(uint64 StampBefore, TArrayView<const FGameplayTag> ChangedTags)
+{
+    UpdateEffectiveValues(IsEffectiveValueTableInSync(StampBefore), ChangedTags);
+    RecordFrameSnapshotChanges(StampBefore, ChangedTags);
+}
+
+void UGameplayTagValueSubsystem::HandleAllTagValuesChanged()
+{
+    // Both caches are marked stale in constant time rather than per changed tag
+    if (bEffectiveValueTableEnabled && bEffectiveValuesValid)
+    {
+        InvalidateEffectiveValues();
+        EffectiveValuesStamp = GetRepositoryStamp();
+    }
+    if (IsFrameSnapshotEnabled())
+    {
+        InvalidateFrameSnapshots();
+        FrameSnapshotTrackedStamp = GetRepositoryStamp();
+    }
+}
+
+void UGameplayTagValueSubsystem::GatherResolveCandidates(int32 RootIndex, FResolveCandidates& OutCandidates) const
+{
+    OutCandidates.Reset();
+    for (ITagValueRepository* Repository : SortedRepositories)
+    {
+        const FTagValueMembershipFilter* Filter = Repository->GetMembershipFilter();
+        if (!Filter || Filter->MayContainUnder(RootIndex))
+        {
+            OutCandidates.Add(FResolveCandidate{ Repository, Filter });
+        }
+    }
+}
+
+bool UGameplayTagValueSubsystem::FindInCandidates(const FGameplayTag& Tag, int32 TagIndex, const FResolveCandidates& Candidates, FTagValueResolution& OutResolution) const
+{
+    for (const FResolveCandidate& Candidate : Candidates)
+    {
+        if (Candidate.Filter && !Candidate.Filter->MayContain(TagIndex))
+        {
+            continue;
+        }
+        
+        // The index comes from the ancestor table, so repositories addressed by it skip the tag manager
+        if (Candidate.Repository->TryGetRawAt(Tag, TagIndex, OutResolution.Value))
+        {
+            OutResolution.Repository = Candidate.Repository;
+            OutResolution.ResolvedTag = Tag;
+            return true;
+        }
+    }
+    return false;
+}
+
+void UGameplayTagValueSubsystem::ComputeResolution(int32 TagIndex, FTagValueResolution& OutResolution) const
+{
+    OutResolution = FTagValueResolution();
+    
+    const TArrayView<const FGameplayTag> Chain = AncestorTable.GetChain(AncestorTable.GetTag(TagIndex), TagIndex);
+    const TArrayView<const int32> ChainIndices = AncestorTable.GetChainIndices(Chain);
+    if (Chain.IsEmpty())
+    {
+        return;
+    }
+    
+    FResolveCandidates Candidates;
+    GatherResolveCandidates(ChainIndices.Last(), Candidates);
+    for (int32 ChainIndex = 0; ChainIndex < Chain.Num(); ++ChainIndex)
+    {
+        if (FindInCandidates(Chain[ChainIndex], ChainIndices[ChainIndex], Candidates, OutResolution))
+        {
+            return;
+        }
+    }
+    OutResolution.Value.Reset();
+}
+
+const UGameplayTagValueSubsystem::FTagValueResolution* UGameplayTagValueSubsystem::FindEffectiveValue(const FGameplayTag& Tag, int32 TagIndex) const
+{
+    SyncEffectiveValues();
+    if (!EffectiveValues.IsValidIndex(TagIndex) || AncestorTable.GetTag(TagIndex) != Tag)
+    {
+        return nullptr;
+    }
+    
+    FEffectiveTagValue& Entry = EffectiveValues[TagIndex];
+    if (Entry.Epoch != EffectiveValuesEpoch)
+    {
+        ComputeResolution(TagIndex, Entry.Resolution);
+        Entry.Epoch = EffectiveValuesEpoch;
+    }
+    return &Entry.Resolution;
+}
+
+void UGameplayTagValueSubsystem::SyncEffectiveValues() const
+{
+    const uint64 Stamp = GetRepositoryStamp();
+    if (bEffectiveValuesValid && EffectiveValuesStamp == Stamp)
+    {
+        return;
+    }
+    
+    // Entries are resolved as they are read, so sizing the table is all a tag tree change needs
+    if (!bEffectiveValuesValid)
+    {
+        EffectiveValues.SetNum(AncestorTable.Num());
+        bEffectiveValuesValid = true;
+    }
+    
+    // Something changed that the subsystem did not see; any entry may be affected, but none is resolved until read
+    InvalidateEffectiveValues();
+    EffectiveValuesStamp = Stamp;
+}
+
+void UGameplayTagValueSubsystem::InvalidateEffectiveValues() const
+{
+    if (++EffectiveValuesEpoch == 0)
+    {
+        // After a wrap an old entry could carry the new epoch, so every entry is reset once
+        for (FEffectiveTagValue& Entry : EffectiveValues)
+        {
+            Entry.Epoch = 0;
+        }
+        EffectiveValuesEpoch = 1;
+    }
+}
+
+void UGameplayTagValueSubsystem::UpdateEffectiveValues(bool bWasInSync, TArrayView<const FGameplayTag> ChangedTags)
+{
+    // Changes made behind the subsystem's back are caught by the stamp check on the next read
+    if (!bWasInSync)
+    {
+        return;
+    }
+    
+    // Past a point, marking the subtrees one by one costs more than marking the whole table
+    if (ChangedTags.Num() > EffectiveValues.Num() / 8)
+    {
+        InvalidateEffectiveValues();
+    }
+    else
+    {
+        for (const FGameplayTag& Tag : ChangedTags)
+        {
+            const int32 Index = FTagValueTagIndex::GetIndex(Tag);
+            if (!EffectiveValues.IsValidIndex(Index))
+            {
+                continue;
+            }
+            
+            // Only the tag itself and its descendants can inherit the changed value; they are resolved again when read
+            EffectiveValues[Index].Epoch = 0;
+            for (const int32 DescendantIndex : AncestorTable.GetDescendants(Tag))
+            {
+                EffectiveValues[DescendantIndex].Epoch = 0;
+            }
+        }
+    }
+    EffectiveValuesStamp = GetRepositoryStamp();
+}
+
+void UGameplayTagValueSubsystem::GetResolutionCacheStats(int64& OutHits, int64& OutMisses) const
+{
+    OutHits = ResolutionCacheHits;
+    OutMisses = ResolutionCacheMisses;
+}
+
+void UGameplayTagValueSubsystem::ResetResolutionCacheStats()
+{
+    ResolutionCacheHits = 0;
+    ResolutionCacheMisses = 0;
+}
+
+TSharedPtr<ITagValueRepository> UGameplayTagValueSubsystem::GetRepository(FName RepositoryName) const
+{
+    return Repositories.FindRef(RepositoryName);
+}
+
+TArray<TSharedPtr<ITagValueRepository>> UGameplayTagValueSubsystem::GetAllRepositories() const
+{
+    TArray<TSharedPtr<ITagValueRepository>> Result;
+    Result.Reserve(SortedRepositories.Num());
+    for (const ITagValueRepository* Repository : SortedRepositories)
+    {
+        Result.Add(Repositories.FindRef(Repository->GetRepositoryName()));
+    }
+    
+    return Result;
+}
+
+bool UGameplayTagValueSubsystem::IsRepositoryRegistered(const ITagValueRepository& Repository) const
+{
+    const TSharedPtr<ITagValueRepository>* Registered = Repositories.Find(Repository.GetRepositoryName());
+    return Registered && Registered->Get() == &Repository;
+}
+
+bool UGameplayTagValueSubsystem::HasTagValue(FGameplayTag Tag, UObject* Context) const
+{
+    // Check context first if provided
+    if (Context && ImplementsTagValueInterface(Context))
+    {
+        ITagValueInterface* TagValueInterface = GetTagValueInterface(Context);
+        if (TagValueInterface && TagValueInterface->HasTagValue(Tag))
+        {
+            return true;
+        }
+    }
+    
+    // Check repositories, including parent tags (hierarchical inheritance)
+    return Tag.IsValid() && ResolveTag(Tag).Repository != nullptr;
+}
+
+TSharedPtr<ITagValueHolder> UGameplayTagValueSubsystem::GetRawValue(FGameplayTag Tag, UObject* Context) const
+{
+    // Check context first if provided
+    if (Context && ImplementsTagValueInterface(Context))
+    {
+        // Context objects handle their own tag hierarchy, so we don't need to check parent tags here
+        // This is because the context might have specific override logic
+    }
+    
+    if (!Tag.IsValid())
+    {
+        return nullptr;
+    }
+    
+    // Check repositories, including parent tags (hierarchical inheritance)
+    const FTagValueResolution Resolution = ResolveTag(Tag);
+    return Resolution.Repository ? Resolution.Repository->GetValue(Resolution.ResolvedTag) : nullptr;
+}
+
+bool UGameplayTagValueSubsystem::TryGetRaw(FGameplayTag Tag, FTagValueVariant& OutValue) const
+{
+    if (!Tag.IsValid())
+    {
+        OutValue.Reset();
+        return false;
+    }
+    
+    OutValue = ResolveTag(Tag).Value;
+    return OutValue.IsSet();
+}
+
+bool UGameplayTagValueSubsystem::TryGetRaw(const FTagValueIndexedTag& Tag, FTagValueVariant& OutValue) const
+{
+    if (!Tag.GetTag().IsValid())
+    {
+        OutValue.Reset();
+        return false;
+    }
+    
+    OutValue = ResolveTag(Tag.GetTag(), Tag.GetIndex()).Value;
+    return OutValue.IsSet();
+}
+
+bool UGameplayTagValueSubsystem::BindTagValueHandle(FGameplayTag Tag, FTagValueVariant& OutValue, FTagValueHandleBinding& OutBinding) const
+{
+    OutBinding.Reset();
+    OutBinding.LayoutGeneration = RepositoryLayoutGeneration;
+    OutBinding.bBound = true;
+    
+    if (!Tag.IsValid())
+    {
+        OutValue.Reset();
+        return false;
+    }
+    
+    const FTagValueResolution Resolution = ResolveTag(Tag);
+    OutValue = Resolution.Value;
+    GatherDependencies(Tag, Resolution, OutBinding.Dependencies);
+    return OutValue.IsSet();
+}
+
+int32 UGameplayTagValueSubsystem::GetValuesBatch(TArrayView<const FGameplayTag> Tags, TArrayView<FTagValueVariant> OutValues) const
+{
+    check(Tags.Num() == OutValues.Num());
+    
+    int32 NumFound = 0;
+    for (int32 Index = 0; Index < Tags.Num(); ++Index)
+    {
+        if (!Tags[Index].IsValid())
+        {
+            OutValues[Index].Reset();
+            continue;
+        }
+        
+        OutValues[Index] = ResolveTag(Tags[Index]).Value;
+        if (OutValues[Index].IsSet())
+        {
+            ++NumFound;
+        }
+    }
+    return NumFound;
+}
+
+int32 UGameplayTagValueSubsystem::GetBoolValuesForTags(const FGameplayTagContainer& Tags, TMap<FGameplayTag, bool>& OutValues) const
+{
+    return GetTypedValuesForTags<FBoolTagValue>(Tags, OutValues);
+}
+
+int32 UGameplayTagValueSubsystem::GetIntValuesForTags(const FGameplayTagContainer& Tags, TMap<FGameplayTag, int32>& OutValues) const
+{
+    return GetTypedValuesForTags<FIntTagValue>(Tags, OutValues);
+}
+
+int32 UGameplayTagValueSubsystem::GetFloatValuesForTags(const FGameplayTagContainer& Tags, TMap<FGameplayTag, float>& OutValues) const
+{
+    return GetTypedValuesForTags<FFloatTagValue>(Tags, OutValues);
+}
+
+int32 UGameplayTagValueSubsystem::GetStringValuesForTags(const FGameplayTagContainer& Tags, TMap<FGameplayTag, FString>& OutValues) const
+{
+    return GetTypedValuesForTags<FStringTagValue>(Tags, OutValues);
+}
+
+int32 UGameplayTagValueSubsystem::GetTransformValuesForTags(const FGameplayTagContainer& Tags, TMap<FGameplayTag, FTransform>& OutValues) const
+{
+    return GetTypedValuesForTags<FTransformTagValue>(Tags, OutValues);
+}
+
+int32 UGameplayTagValueSubsystem::GetClassValuesForTags(const FGameplayTagContainer& Tags, TMap<FGameplayTag, TSoftClassPtr<UObject>>& OutValues) const
+{
+    return GetTypedValuesForTags<FClassTagValue>(Tags, OutValues);
+}
+
+int32 UGameplayTagValueSubsystem::GetObjectValuesForTags(const FGameplayTagContainer& Tags, TMap<FGameplayTag, TSoftObjectPtr<UObject>>& OutValues) const
+{
+    return GetTypedValuesForTags<FObjectTagValue>(Tags, OutValues);
+}
+
+bool UGameplayTagValueSubsystem::SetRawValue(FGameplayTag Tag, TSharedPtr<ITagValueHolder> Value, FName RepositoryName)
+{
+    if (!Tag.IsValid())
+    {
+        return false;
+    }
+    
+    ITagValueRepository* Repository = GetBestRepository(RepositoryName);
+    if (!Repository)
+    {
+        return false;
+    }
+    
+    // Inside a batch the write is applied on commit
+    if (BatchDepth > 0)
+    {
+        StagedWrites.Add({ Tag, Repository->GetRepositoryName(), MoveTemp(Value) });
+        return true;
+    }
+    
+    ApplyRawValue(*Repository, Tag, Value);
+    
+    return true;
+}
+
+void UGameplayTagValueSubsystem::ApplyRawValue(ITagValueRepository& Repository, FGameplayTag Tag, const TSharedPtr<ITagValueHolder>& Value)
+{
+    TSharedPtr<ITagValueHolder> OldValue = Repository.GetValue(Tag);
+    const uint64 StampBefore = GetRepositoryStamp();
+    const uint32 GenerationBefore = Repository.GetGeneration();
+    
+    if (!Value.IsValid())
+    {
+        Repository.RemoveValue(Tag);
+    }
+    else
+    {
+        Repository.SetValue(Tag, Value);
+    }
+    
+    // Cached reads only notice writes that bump the repository generation
+    ensureMsgf(Repository.GetGeneration() != GenerationBefore || (Value.IsValid() ? !Repository.HasValue(Tag) : !OldValue.IsValid() || Repository.HasValue(Tag)),
+        TEXT("Repository %s changed %s without calling BumpGeneration"), *Repository.GetRepositoryName().ToString(), *Tag.ToString());
+    HandleTagValuesChanged(StampBefore, MakeArrayView(&Tag, 1));
+    
+    BroadcastTagValueChanged(Tag, Repository.GetRepositoryName(), OldValue, Value);
+}
+
+void UGameplayTagValueSubsystem::BeginBatch()
+{
+    ++BatchDepth;
+}
+
+void UGameplayTagValueSubsystem::CommitBatch()
+{
+    if (BatchDepth == 0)
+    {
+        return;
+    }
+    
+    // Nested batches are applied by the outermost commit
+    if (BatchDepth > 1)
+    {
+        --BatchDepth;
+        return;
+    }
+    
+    FlushStagedWrites();
+    BatchDepth = 0;
+    
+    // In EndOfFrame mode the batch's changes are delivered with the rest of the frame's changes
+    if (ChangeDispatchMode == ETagValueChangeDispatchMode::Immediate)
+    {
+        FlushPendingChanges(true);
+    }
+}
+
+void UGameplayTagValueSubsystem::SetChangeDispatchMode(ETagValueChangeDispatchMode Mode)
+{
+    if (Mode == ChangeDispatchMode)
+    {
+        return;
+    }
+    
+    ChangeDispatchMode = Mode;
+    if (Mode == ETagValueChangeDispatchMode::EndOfFrame)
+    {
+        EndOfFrameHandle = FCoreDelegates::OnEndFrame.AddUObject(this, &UGameplayTagValueSubsystem::FlushDeferredChanges);
+    }
+    else
+    {
+        FCoreDelegates::OnEndFrame.Remove(EndOfFrameHandle);
+        EndOfFrameHandle.Reset();
+        
+        // Deliver what was collected so far, unless a batch will deliver it on commit
+        if (BatchDepth == 0)
+        {
+            FlushPendingChanges(false);
+        }
+    }
+}
+
+void UGameplayTagValueSubsystem::FlushDeferredChanges()
+{
+    // Changes of an open batch are delivered once the batch is committed
+    if (BatchDepth == 0)
+    {
+        FlushPendingChanges(false);
+    }
+}
+
+void UGameplayTagValueSubsystem::SetFrameSnapshotEnabled(bool bEnabled)
+{
+    if (bEnabled == bFrameSnapshotEnabled.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+    
+    if (bEnabled)
+    {
+        // Changes were not recorded while disabled, so both buffers start over; publish right away so
+        // readers can use the snapshot this frame. Readers are let back in by the first publish that succeeds.
+        bFrameSnapshotEnabled.store(true, std::memory_order_relaxed);
+        InvalidateFrameSnapshots();
+        FrameSnapshotTrackedStamp = GetRepositoryStamp();
+        PublishFrameSnapshot();
+        FrameSnapshotHandle = FCoreDelegates::OnEndFrame.AddUObject(this, &UGameplayTagValueSubsystem::PublishFrameSnapshot);
+    }
+    else
+    {
+        // The buffers are kept: readers that got past the check may still be in the front buffer
+        bFrameSnapshotEnabled.store(false, std::memory_order_relaxed);
+        bFrameSnapshotReadable.store(false, std::memory_order_release);
+        FCoreDelegates::OnEndFrame.Remove(FrameSnapshotHandle);
+        FrameSnapshotHandle.Reset();
+    }
+}
+
+void UGameplayTagValueSubsystem::PublishFrameSnapshot()
+{
+    const uint64 Stamp = GetRepositoryStamp();
+    if (Stamp != FrameSnapshotTrackedStamp)
+    {
+        // A repository was written to without going through the subsystem, so any tag may have changed
+        InvalidateFrameSnapshots();
+        FrameSnapshotTrackedStamp = Stamp;
+    }
+    
+    const uint32 FrontEpoch = FrameSnapshotEpoch.GetEpoch();
+    const FFrameSnapshot& FrontSnapshot = FrameSnapshots[FrontEpoch & 1];
+    if (!FrontSnapshot.bNeedsRebuild && FrontSnapshot.Stamp == Stamp)
+    {
+        return;
+    }
+    
+    // Readers that entered the back buffer while it was the front one may not have left yet; until they
+    // have, readers keep using the front buffer and the changes stay recorded for a later frame
+    if (FrameSnapshotEpoch.HasPreviousEpochReaders())
+    {
+        return;
+    }
+    
+    // The back buffer misses the changes made since it was last published
+    FFrameSnapshot& Snapshot = FrameSnapshots[(FrontEpoch + 1) & 1];
+    if (Snapshot.bNeedsRebuild)
+    {
+        RebuildFrameSnapshot(Snapshot);
+    }
+    else
+    {
+        PatchFrameSnapshot(Snapshot);
+    }
+    Snapshot.ChangedTagIndices.Reset();
+    Snapshot.bNeedsRebuild = false;
+    Snapshot.Stamp = Stamp;
+    
+    // Readers entering from now on use the buffer just published
+    FrameSnapshotEpoch.Advance();
+    bFrameSnapshotReadable.store(true, std::memory_order_release);
+}
+
+void UGameplayTagValueSubsystem::RecordFrameSnapshotChanges(uint64 StampBefore, TArrayView<const FGameplayTag> ChangedTags)
+{
+    if (!IsFrameSnapshotEnabled())
+    {
+        return;
+    }
+    
+    if (FrameSnapshotTrackedStamp != StampBefore)
+    {
+        // Something changed that the subsystem did not see; the recorded tags would not cover it
+        InvalidateFrameSnapshots();
+    }
+    else
+    {
+        for (FFrameSnapshot& Snapshot : FrameSnapshots)
+        {
+            if (Snapshot.bNeedsRebuild)
+            {
+                continue;
+            }
+            
+            for (const FGameplayTag& Tag : ChangedTags)
+            {
+                const int32 Index = FTagValueTagIndex::GetIndex(Tag);
+                if (Index != INDEX_NONE)
+                {
+                    Snapshot.ChangedTagIndices.Add(Index);
+                }
+            }
+            
+            // Past a point, resolving the subtrees one by one costs more than resolving every tag
+            if (Snapshot.ChangedTagIndices.Num() > AncestorTable.Num() / 8)
+            {
+                Snapshot.ChangedTagIndices.Reset();
+                Snapshot.bNeedsRebuild = true;
+            }
+        }
+    }
+    FrameSnapshotTrackedStamp = GetRepositoryStamp();
+}
+
+void UGameplayTagValueSubsystem::InvalidateFrameSnapshots()
+{
+    for (FFrameSnapshot& Snapshot : FrameSnapshots)
+    {
+        Snapshot.ChangedTagIndices.Reset();
+        Snapshot.bNeedsRebuild = true;
+    }
+}
+
+void UGameplayTagValueSubsystem::RebuildFrameSnapshot(FFrameSnapshot& Snapshot) const
+{
+    const int32 NumTags = AncestorTable.Num();
+    Snapshot.Values.Reset();
+    Snapshot.Values.SetNum(NumTags);
+    Snapshot.TagIndices.Reset();
+    Snapshot.TagIndices.Reserve(NumTags);
+    
+    for (int32 Index = 0; Index < NumTags; ++Index)
+    {
+        const FGameplayTag Tag = AncestorTable.GetTag(Index);
+        if (Tag.IsValid())
+        {
+            Snapshot.TagIndices.Add(Tag, Index);
+            Snapshot.Values[Index] = ResolveTag(Tag, Index).Value;
+        }
+    }
+}
+
+void UGameplayTagValueSubsystem::PatchFrameSnapshot(FFrameSnapshot& Snapshot) const
+{
+    for (const int32 Index : Snapshot.ChangedTagIndices)
+    {
+        const FGameplayTag Tag = AncestorTable.GetTag(Index);
+        if (!Tag.IsValid() || !Snapshot.Values.IsValidIndex(Index))
+        {
+            continue;
+        }
+        
+        // Only the tag itself and its descendants can inherit the changed value
+        Snapshot.Values[Index] = ResolveTag(Tag, Index).Value;
+        for (const int32 DescendantIndex : AncestorTable.GetDescendants(Tag))
+        {
+            Snapshot.Values[DescendantIndex] = ResolveTag(AncestorTable.GetTag(DescendantIndex), DescendantIndex).Value;
+        }
+    }
+}
+
+bool UGameplayTagValueSubsystem::GetFrameBoolValue(FGameplayTag Tag, bool DefaultValue) const
+{
+    TryGetFrameValue(Tag, DefaultValue);
+    return DefaultValue;
+}
+
+int32 UGameplayTagValueSubsystem::GetFrameIntValue(FGameplayTag Tag, int32 DefaultValue) const
+{
+    TryGetFrameValue(Tag, DefaultValue);
+    return DefaultValue;
+}
+
+float UGameplayTagValueSubsystem::GetFrameFloatValue(FGameplayTag Tag, float DefaultValue) const
+{
+    TryGetFrameValue(Tag, DefaultValue);
+    return DefaultValue;
+}
+
+FTransform UGameplayTagValueSubsystem::GetFrameTransformValue(FGameplayTag Tag, const FTransform& DefaultValue) const
+{
+    FTransform Value = DefaultValue;
+    TryGetFrameValue(Tag, Value);
+    return Value;
+}
+
+void UGameplayTagValueSubsystem::AddPendingChange(FGameplayTag Tag, FName RepositoryName, const TSharedPtr<ITagValueHolder>& OldValue, const TSharedPtr<ITagValueHolder>& NewValue)
 {
-    Super::Initialize(Collection);
-    
-    // Create the default repository
-    TSharedPtr<FMemoryTagValueRepository> DefaultRepository = MakeShared<FMemoryTagValueRepository>(DefaultRepositoryName, 100);
-    RegisterRepository(DefaultRepository);
-    
-    // Register any configured data assets
-    RegisterConfiguredDataAssets();
+    AddPendingChange(FPendingTagValueChange{ Tag, RepositoryName, OldValue, NewValue });
 }
 
-void UGameplayTagValueSubsystem::Deinitialize()
+void UGameplayTagValueSubsystem::AddPendingChange(FPendingTagValueChange&& Change)
 {
-    // Clear all repositories
-    Repositories.Empty();
+    // A clear is never merged; changes made after it are reported after it
+    if (!Change.Tag.IsValid())
+    {
+        PendingChanges.Add(MoveTemp(Change));
+        return;
+    }
     
-    Super::Deinitialize();
+    PendingChangedTags.AddTag(Change.Tag);
+    if (const int32* ExistingIndex = PendingChangeIndex.Find(MakeTuple(Change.Tag, Change.RepositoryName)))
+    {
+        // Keep the value from before the first change and report the latest value
+        PendingChanges[*ExistingIndex].NewValue = MoveTemp(Change.NewValue);
+    }
+    else
+    {
+        const TPair<FGameplayTag, FName> Key(Change.Tag, Change.RepositoryName);
+        PendingChangeIndex.Add(Key, PendingChanges.Add(MoveTemp(Change)));
+    }
 }
 
-void UGameplayTagValueSubsystem::RegisterRepository(TSharedPtr<ITagValueRepository> Repository)
+void UGameplayTagValueSubsystem::FlushPendingChanges(bool bAsBatch)
 {
-    if (!Repository.IsValid())
+    if (PendingChanges.IsEmpty())
     {
         return;
     }
     
-    // Remove any existing repository with the same name
-    UnregisterRepository(Repository->GetRepositoryName());
+    // Take the pending changes so listeners can make new changes while being notified
+    FGameplayTagContainer ChangedTags = MoveTemp(PendingChangedTags);
+    TArray<FPendingTagValueChange> Changes = MoveTemp(PendingChanges);
+    PendingChangedTags.Reset();
+    PendingChanges.Reset();
+    PendingChangeIndex.Reset();
     
-    // Add the new repository
-    Repositories.Add(Repository->GetRepositoryName(), Repository);
+    // A committed batch is delivered in full; deferred changes respect the dispatch budget
+    const bool bUseBudget = !bAsBatch && ChangeDispatchBudget > 0.0;
+    const double StartTime = bUseBudget ? FPlatformTime::Seconds() : 0.0;
+    
+    // Subscribers and general listeners hear about each tag once
+    for (int32 Index = 0; Index < Changes.Num(); ++Index)
+    {
+        const FPendingTagValueChange& Change = Changes[Index];
+        if (Change.Tag.IsValid())
+        {
+            DispatchTagValueChange(FTagValueChangeEvent(Change.Tag, Change.RepositoryName, Change.OldValue.Get(), Change.NewValue.Get()));
+            BroadcastDynamicTagValueChanged(Change.Tag, Change.RepositoryName);
+        }
+        else
+        {
+            DispatchRepositoryCleared(Change.RepositoryName, Change.ClearedValues.Get());
+        }
+        
+        if (bUseBudget && Index + 1 < Changes.Num() && FPlatformTime::Seconds() - StartTime >= ChangeDispatchBudget)
+        {
+            RequeuePendingChanges(TArrayView<FPendingTagValueChange>(Changes).RightChop(Index + 1));
+            break;
+        }
+    }
+    
+    // A committed batch is also announced as a whole, after its per-tag events
+    if (bAsBatch)
+    {
+        OnTagValuesBatchChanged.Broadcast(ChangedTags);
+    }
 }
 
-void UGameplayTagValueSubsystem::UnregisterRepository(FName RepositoryName)
+FTagValueSubscriptionHandle UGameplayTagValueSubsystem::SubscribeToTag(FGameplayTag Tag, ETagValueSubscriptionScope Scope, FOnTagValueChangedNative Delegate)
 {
-    Repositories.Remove(RepositoryName);
+    return Subscriptions.Subscribe(Tag, Scope, MoveTemp(Delegate));
 }
 
-TSharedPtr<ITagValueRepository> UGameplayTagValueSubsystem::GetRepository(FName RepositoryName) const
+FTagValueSubscriptionHandle UGameplayTagValueSubsystem::K2_SubscribeToTag(FGameplayTag Tag, ETagValueSubscriptionScope Scope, FOnTagValueChangedDynamic Delegate)
 {
-    return Repositories.FindRef(RepositoryName);
+    return Subscriptions.Subscribe(Tag, Scope, MoveTemp(Delegate));
 }
 
-TArray<TSharedPtr<ITagValueRepository>> UGameplayTagValueSubsystem::GetAllRepositories() const
+bool UGameplayTagValueSubsystem::UnsubscribeFromTag(FTagValueSubscriptionHandle& Handle)
 {
-    TArray<TSharedPtr<ITagValueRepository>> Result;
-    Repositories.GenerateValueArray(Result);
-    
-    // Sort by priority (highest first)
-    Result.Sort([](const TSharedPtr<ITagValueRepository>& A, const TSharedPtr<ITagValueRepository>& B)
+    const bool bRemoved = Subscriptions.Unsubscribe(Handle);
+    Handle.Reset();
+    return bRemoved;
+}
+
+void UGameplayTagValueSubsystem::EnqueueRawValue(FGameplayTag Tag, TSharedPtr<ITagValueHolder> Value, FName RepositoryName)
+{
+    if (Tag.IsValid())
     {
-        return A->GetPriority() > B->GetPriority();
-    });
-    
-    return Result;
+        const EStagedWriteKind Kind = Value.IsValid() ? EStagedWriteKind::Set : EStagedWriteKind::Remove;
+        QueuedWrites.Enqueue({ Tag, RepositoryName, MoveTemp(Value), Kind });
+    }
 }
 
-bool UGameplayTagValueSubsystem::HasTagValue(FGameplayTag Tag, UObject* Context) const
+void UGameplayTagValueSubsystem::DrainQueuedWrites()
 {
-    // Check context first if provided
-    if (Context && ImplementsTagValueInterface(Context))
+    check(IsInGameThread());
+    
+    if (QueuedWrites.IsEmpty())
     {
-        ITagValueInterface* TagValueInterface = GetTagValueInterface(Context);
-        if (TagValueInterface && TagValueInterface->HasTagValue(Tag))
-        {
-            return true;
-        }
+        return;
     }
     
-    // Check repositories
-    TArray<TSharedPtr<ITagValueRepository>> RepositoryArray = GetAllRepositories();
-    for (const TSharedPtr<ITagValueRepository>& Repository : RepositoryArray)
+    // Keep only the last operation of each kind per tag and repository. A removal and a set with the same
+    // repository name do not target the same values (None removes from all repositories but sets into the
+    // best one), so they are never merged. Superseded operations are blanked, not replaced, so the surviving
+    // ones keep their relative order.
+    TArray<FStagedTagValueWrite> Writes;
+    TMap<TTuple<FGameplayTag, FName, EStagedWriteKind>, int32> WriteIndex;
+    FStagedTagValueWrite Write;
+    while (QueuedWrites.Dequeue(Write))
     {
-        if (Repository->HasValue(Tag))
+        const int32 NewIndex = Writes.Add(MoveTemp(Write));
+        const TTuple<FGameplayTag, FName, EStagedWriteKind> Key(Writes[NewIndex].Tag, Writes[NewIndex].RepositoryName, Writes[NewIndex].Kind);
+        if (int32* ExistingIndex = WriteIndex.Find(Key))
         {
-            return true;
+            Writes[*ExistingIndex].Tag = FGameplayTag();
+            *ExistingIndex = NewIndex;
+        }
+        else
+        {
+            WriteIndex.Add(Key, NewIndex);
         }
     }
     
-    // Check parent tags (hierarchical inheritance)
-    FGameplayTag ParentTag = Tag.RequestDirectParent();
-    while (ParentTag.IsValid())
+    FTagValueWriteBatch Batch(this);
+    for (FStagedTagValueWrite& QueuedWrite : Writes)
     {
-        for (const TSharedPtr<ITagValueRepository>& Repository : RepositoryArray)
+        if (!QueuedWrite.Tag.IsValid())
         {
-            if (Repository->HasValue(ParentTag))
-            {
-                return true;
-            }
+            continue;
         }
         
-        ParentTag = ParentTag.RequestDirectParent();
+        if (QueuedWrite.Kind == EStagedWriteKind::Set)
+        {
+            SetRawValue(QueuedWrite.Tag, MoveTemp(QueuedWrite.Value), QueuedWrite.RepositoryName);
+        }
+        else
+        {
+            RemoveTagValue(QueuedWrite.Tag, QueuedWrite.RepositoryName);
+        }
     }
-    
-    return false;
 }
 
-TSharedPtr<ITagValueHolder> UGameplayTagValueSubsystem::GetRawValue(FGameplayTag Tag, UObject* Context) const
+void UGameplayTagValueSubsystem::FlushStagedWrites()
 {
-    // Check context first if provided
-    if (Context && ImplementsTagValueInterface(Context))
-    {
-        // Context objects handle their own tag hierarchy, so we don't need to check parent tags here
-        // This is because the context might have specific override logic
-    }
-    
-    // Check repositories for exact match
-    TArray<TSharedPtr<ITagValueRepository>> RepositoryArray = GetAllRepositories();
-    for (const TSharedPtr<ITagValueRepository>& Repository : RepositoryArray)
-    {
-        if (Repository->HasValue(Tag))
-        {
-            return Repository->GetValue(Tag);
-        }
-    }
+    TArray<FStagedTagValueWrite> Writes = MoveTemp(StagedWrites);
+    StagedWrites.Reset();
     
-    // Check parent tags (hierarchical inheritance)
-    FGameplayTag ParentTag = Tag.RequestDirectParent();
-    while (ParentTag.IsValid())
+    for (const FStagedTagValueWrite& Write : Writes)
     {
-        for (const TSharedPtr<ITagValueRepository>& Repository : RepositoryArray)
+        switch (Write.Kind)
         {
-            if (Repository->HasValue(ParentTag))
+        case EStagedWriteKind::Set:
+            // The target repository may have been unregistered since the write was staged
+            if (TSharedPtr<ITagValueRepository> Repository = GetRepository(Write.RepositoryName))
             {
-                return Repository->GetValue(ParentTag);
+                ApplyRawValue(*Repository, Write.Tag, Write.Value);
             }
+            break;
+        case EStagedWriteKind::Remove:
+            ApplyRemoveValue(Write.Tag, Write.RepositoryName);
+            break;
+        case EStagedWriteKind::Clear:
+            ApplyClearAllValues(Write.RepositoryName);
+            break;
         }
-        
-        ParentTag = ParentTag.RequestDirectParent();
     }
-    
-    return nullptr;
 }
 
-bool UGameplayTagValueSubsystem::SetRawValue(FGameplayTag Tag, TSharedPtr<ITagValueHolder> Value, FName RepositoryName)
+bool UGameplayTagValueSubsystem::RemoveTagValue(FGameplayTag Tag, FName RepositoryName)
 {
     if (!Tag.IsValid())
     {
         return false;
     }
     
-    TSharedPtr<ITagValueRepository> Repository = GetBestRepository(RepositoryName);
-    if (!Repository.IsValid())
-    {
-        return false;
-    }
-    
-    TSharedPtr<ITagValueHolder> OldValue = Repository->GetValue(Tag);
-    
-    if (!Value.IsValid())
-    {
-        Repository->RemoveValue(Tag);
-    }
-    else
+    // Inside a batch the removal is applied on commit, after the writes staged before it
+    if (BatchDepth > 0)
     {
-        Repository->SetValue(Tag, Value);
+        StagedWrites.Add({ Tag, RepositoryName, nullptr, EStagedWriteKind::Remove });
+        
+        // Report whether there is a value to remove, counting values staged earlier in the batch
+        const bool bStaged = StagedWrites.ContainsByPredicate([Tag, RepositoryName](const FStagedTagValueWrite& Write)
+        {
+            return Write.Kind == EStagedWriteKind::Set && Write.Tag == Tag && (RepositoryName == NAME_None || Write.RepositoryName == RepositoryName);
+        });
+        if (bStaged)
+        {
+            return true;
+        }
+        if (RepositoryName != NAME_None)
+        {
+            const TSharedPtr<ITagValueRepository> Repository = GetRepository(RepositoryName);
+            return Repository.IsValid() && Repository->HasValue(Tag);
+        }
+        return GetAllRepositories().ContainsByPredicate([this, Tag](const TSharedPtr<ITagValueRepository>& Repository)
+        {
+            return IsRepositoryRegistered(*Repository) && Repository->HasValue(Tag);
+        });
     }
     
-    BroadcastTagValueChanged(Tag, Repository->GetRepositoryName(), OldValue, Value);
-    
-    return true;
+    return ApplyRemoveValue(Tag, RepositoryName);
 }
 
-bool UGameplayTagValueSubsystem::RemoveTagValue(FGameplayTag Tag, FName RepositoryName)
+bool UGameplayTagValueSubsystem::ApplyRemoveValue(FGameplayTag Tag, FName RepositoryName)
 {
-    if (!Tag.IsValid())
-    {
-        return false;
-    }
-    
     bool bRemovedAny = false;
     
     if (RepositoryName != NAME_None)
@@ -249,7 +1254,9 @@ bool UGameplayTagValueSubsystem::RemoveTagValue(FGameplayTag Tag, FName Reposito
             if (Repository->HasValue(Tag))
             {
                 TSharedPtr<ITagValueHolder> OldValue = Repository->GetValue(Tag);
+                const uint64 StampBefore = GetRepositoryStamp();
                 Repository->RemoveValue(Tag);
+                HandleTagValuesChanged(StampBefore, MakeArrayView(&Tag, 1));
                 BroadcastTagValueChanged(Tag, Repository->GetRepositoryName(), OldValue, nullptr);
                 bRemovedAny = true;
             }
@@ -257,14 +1264,16 @@ bool UGameplayTagValueSubsystem::RemoveTagValue(FGameplayTag Tag, FName Reposito
     }
     else
     {
-        // Remove from all repositories
-        TArray<TSharedPtr<ITagValueRepository>> RepositoryArray = GetAllRepositories();
-        for (const TSharedPtr<ITagValueRepository>& Repository : RepositoryArray)
+        // Remove from all repositories; listeners may register or unregister repositories while
+        // being notified, so iterate an owning copy of the current order
+        for (const TSharedPtr<ITagValueRepository>& Repository : GetAllRepositories())
         {
-            if (Repository->HasValue(Tag))
+            if (IsRepositoryRegistered(*Repository) && Repository->HasValue(Tag))
             {
                 TSharedPtr<ITagValueHolder> OldValue = Repository->GetValue(Tag);
+                const uint64 StampBefore = GetRepositoryStamp();
                 Repository->RemoveValue(Tag);
+                HandleTagValuesChanged(StampBefore, MakeArrayView(&Tag, 1));
                 BroadcastTagValueChanged(Tag, Repository->GetRepositoryName(), OldValue, nullptr);
                 bRemovedAny = true;
             }
@@ -275,6 +1284,18 @@ bool UGameplayTagValueSubsystem::RemoveTagValue(FGameplayTag Tag, FName Reposito
 }
 
 void UGameplayTagValueSubsystem::ClearAllValues(FName RepositoryName)
+{
+    // Inside a batch the clear is applied on commit, after the writes staged before it
+    if (BatchDepth > 0)
+    {
+        StagedWrites.Add({ FGameplayTag(), RepositoryName, nullptr, EStagedWriteKind::Clear });
+        return;
+    }
+    
+    ApplyClearAllValues(RepositoryName);
+}
+
+void UGameplayTagValueSubsystem::ApplyClearAllValues(FName RepositoryName)
 {
     if (RepositoryName != NAME_None)
     {
@@ -282,43 +1303,177 @@ void UGameplayTagValueSubsystem::ClearAllValues(FName RepositoryName)
         TSharedPtr<ITagValueRepository> Repository = GetRepository(RepositoryName);
         if (Repository.IsValid())
         {
-            // Get all tags before clearing
-            TArray<FGameplayTag> Tags = Repository->GetAllTags();
-            
-            // Clear repository
-            Repository->ClearAllValues();
-            
-            // Broadcast changes for each tag
-            for (const FGameplayTag& Tag : Tags)
+            ClearRepository(*Repository);
+        }
+    }
+    else
+    {
+        // Clear all repositories; iterate an owning copy, as cleared listeners may change the registrations
+        for (const TSharedPtr<ITagValueRepository>& Repository : GetAllRepositories())
+        {
+            if (IsRepositoryRegistered(*Repository))
             {
-                BroadcastTagValueChanged(Tag, Repository->GetRepositoryName(), nullptr, nullptr);
+                ClearRepository(*Repository);
             }
         }
     }
+}
+
+void UGameplayTagValueSubsystem::ClearRepository(ITagValueRepository& Repository)
+{
+    const FName ClearedRepositoryName = Repository.GetRepositoryName();
+    
+    // Only subscribers need old values, and they look them up when the clear is delivered, so the values
+    // are handed over instead of being read out now; without subscribers they are simply dropped
+    TSharedPtr<ITagValueRepository> ClearedValues;
+    if (Subscriptions.Num() > 0)
+    {
+        ClearedValues = Repository.DetachAllValues();
+    }
     else
     {
-        // Clear all repositories
-        TArray<TSharedPtr<ITagValueRepository>> RepositoryArray = GetAllRepositories();
-        for (const TSharedPtr<ITagValueRepository>& Repository : RepositoryArray)
+        Repository.ClearAllValues();
+    }
+    HandleAllTagValuesChanged();
+    FoldPendingChangesIntoClear(ClearedRepositoryName, ClearedValues.Get());
+    
+    // The clear is delivered like any other change: on commit inside a batch, and at the end of the frame in EndOfFrame mode
+    if (BatchDepth > 0 || ChangeDispatchMode == ETagValueChangeDispatchMode::EndOfFrame)
+    {
+        AddPendingChange(FPendingTagValueChange{ FGameplayTag(), ClearedRepositoryName, nullptr, nullptr, MoveTemp(ClearedValues) });
+        return;
+    }
+    
+    DispatchRepositoryCleared(ClearedRepositoryName, ClearedValues.Get());
+}
+
+void UGameplayTagValueSubsystem::FoldPendingChangesIntoClear(FName RepositoryName, ITagValueRepository* ClearedValues)
+{
+    if (PendingChanges.IsEmpty())
+    {
+        return;
+    }
+    
+    TArray<FPendingTagValueChange> Changes = MoveTemp(PendingChanges);
+    PendingChanges.Reset();
+    PendingChangeIndex.Reset();
+    PendingChangedTags.Reset();
+    
+    for (FPendingTagValueChange& Change : Changes)
+    {
+        if (Change.RepositoryName != RepositoryName || !Change.Tag.IsValid())
         {
-            // Get all tags before clearing
-            TArray<FGameplayTag> Tags = Repository->GetAllTags();
-            
-            // Clear repository
-            Repository->ClearAllValues();
-            
-            // Broadcast changes for each tag
-            for (const FGameplayTag& Tag : Tags)
+            AddPendingChange(MoveTemp(Change));
+        }
+        else if (ClearedValues)
+        {
+            // Listeners never heard of the newer value; the clear removes the one they last saw
+            if (Change.OldValue.IsValid())
             {
-                BroadcastTagValueChanged(Tag, Repository->GetRepositoryName(), nullptr, nullptr);
+                ClearedValues->SetValue(Change.Tag, MoveTemp(Change.OldValue));
+            }
+            else
+            {
+                ClearedValues->RemoveValue(Change.Tag);
             }
         }
     }
 }
 
+void UGameplayTagValueSubsystem::DispatchRepositoryCleared(FName RepositoryName, const ITagValueRepository* ClearedValues)
+{
+    // Subscribers work per tag and look up the old values of their own tags; everyone else hears about the repository as a whole
+    if (ClearedValues)
+    {
+        Subscriptions.DispatchCleared(RepositoryName, *ClearedValues);
+    }
+    OnRepositoryClearedNative.Broadcast(RepositoryName);
+    OnRepositoryCleared.Broadcast(RepositoryName);
+}
+
 void UGameplayTagValueSubsystem::BroadcastTagValueChanged(FGameplayTag Tag, FName RepositoryName, const TSharedPtr<ITagValueHolder>& OldValue, const TSharedPtr<ITagValueHolder>& NewValue)
 {
+    // Changes inside a batch are announced together on commit, and in EndOfFrame mode at the end of the frame
+    if (BatchDepth > 0 || ChangeDispatchMode == ETagValueChangeDispatchMode::EndOfFrame)
+    {
+        AddPendingChange(Tag, RepositoryName, OldValue, NewValue);
+        return;
+    }
+    
+    DispatchTagValueChange(FTagValueChangeEvent(Tag, RepositoryName, OldValue.Get(), NewValue.Get()));
+    BroadcastDynamicTagValueChanged(Tag, RepositoryName);
+}
+
+void UGameplayTagValueSubsystem::DispatchTagValueChange(const FTagValueChangeEvent& Event)
+{
+    Subscriptions.Dispatch(Event);
+    
+    if (SlowListenerThreshold <= 0.0)
+    {
+        OnTagValueChangedNative.Broadcast(Event);
+        return;
+    }
+    
+    const double StartTime = FPlatformTime::Seconds();
+    OnTagValueChangedNative.Broadcast(Event);
+    const double Elapsed = FPlatformTime::Seconds() - StartTime;
+    if (Elapsed > SlowListenerThreshold)
+    {
+        // Native multicast delegates do not expose their bindings; subscribe through SubscribeToTag for per-listener timing
+        ReportSlowListeners(TEXT("OnTagValueChangedNative"), FString(), Elapsed, Event.Tag);
+    }
+}
+
+void UGameplayTagValueSubsystem::BroadcastDynamicTagValueChanged(FGameplayTag Tag, FName RepositoryName)
+{
+    if (SlowListenerThreshold <= 0.0)
+    {
+        OnTagValueChanged.Broadcast(Tag, RepositoryName);
+        return;
+    }
+    
+    const double StartTime = FPlatformTime::Seconds();
     OnTagValueChanged.Broadcast(Tag, RepositoryName);
+    const double Elapsed = FPlatformTime::Seconds() - StartTime;
+    if (Elapsed > SlowListenerThreshold)
+    {
+        // One Object.Function entry per binding, so several functions bound on the same object can be told apart
+        ReportSlowListeners(TEXT("OnTagValueChanged"), OnTagValueChanged.ToString<UObject>(), Elapsed, Tag);
+    }
+}
+
+void UGameplayTagValueSubsystem::ReportSlowListeners(const TCHAR* EventName, const FString& Bindings, double Elapsed, FGameplayTag Tag) const
+{
+    UE_LOG(LogTemp, Warning, TEXT("Slow %s listeners took %.2f ms handling %s; bound functions: %s"),
+        EventName, Elapsed * 1000.0, *Tag.ToString(), Bindings.IsEmpty() ? TEXT("<unknown>") : *Bindings);
+}
+
+void UGameplayTagValueSubsystem::RequeuePendingChanges(TArrayView<FPendingTagValueChange> Changes)
+{
+    // Changes made by listeners during the flush are already pending; the carried over changes go first
+    TArray<FPendingTagValueChange> NewerChanges = MoveTemp(PendingChanges);
+    PendingChanges.Reset();
+    PendingChangeIndex.Reset();
+    
+    for (FPendingTagValueChange& Change : Changes)
+    {
+        AddPendingChange(MoveTemp(Change));
+    }
+    for (FPendingTagValueChange& Change : NewerChanges)
+    {
+        AddPendingChange(MoveTemp(Change));
+    }
+}
+
+void UGameplayTagValueSubsystem::SetChangeDispatchBudget(float BudgetMilliseconds)
+{
+    ChangeDispatchBudget = FMath::Max(BudgetMilliseconds, 0.0f) / 1000.0;
+}
+
+void UGameplayTagValueSubsystem::SetSlowListenerThreshold(float ThresholdMilliseconds)
+{
+    SlowListenerThreshold = FMath::Max(ThresholdMilliseconds, 0.0f) / 1000.0;
+    Subscriptions.SetSlowSubscriberThreshold(SlowListenerThreshold);
 }
 
 TArray<FGameplayTag> UGameplayTagValueSubsystem::GetAllTags() const
@@ -327,8 +1482,7 @@ TArray<FGameplayTag> UGameplayTagValueSubsystem::GetAllTags() const
     TSet<FGameplayTag> TagSet;
     
     // Add all tags from all repositories
-    TArray<TSharedPtr<ITagValueRepository>> RepositoryArray = GetAllRepositories();
-    for (const TSharedPtr<ITagValueRepository>& Repository : RepositoryArray)
+    for (const ITagValueRepository* Repository : SortedRepositories)
     {
         TArray<FGameplayTag> RepositoryTags = Repository->GetAllTags();
         for (const FGameplayTag& Tag : RepositoryTags)
@@ -349,8 +1503,8 @@ int32 UGameplayTagValueSubsystem::ImportFromDataTable(UDataTable* DataTable, FNa
         return 0;
     }
     
-    TSharedPtr<ITagValueRepository> Repository = GetBestRepository(RepositoryName);
-    if (!Repository.IsValid())
+    ITagValueRepository* Repository = GetBestRepository(RepositoryName);
+    if (!Repository)
     {
         return 0;
     }
@@ -389,6 +1543,11 @@ bool UGameplayTagValueSubsystem::GetBoolValue(FGameplayTag Tag, bool DefaultValu
     return GetTypedValue<FBoolTagValue>(Tag, DefaultValue, Context);
 }
 
+bool UGameplayTagValueSubsystem::TryGetBoolValue(FGameplayTag Tag, bool& OutValue, UObject* Context) const
+{
+    return TryGetTypedValue<FBoolTagValue>(Tag, OutValue, Context);
+}
+
 bool UGameplayTagValueSubsystem::SetBoolValue(FGameplayTag Tag, bool Value, FName RepositoryName)
 {
     return SetTypedValue<FBoolTagValue>(Tag, Value, RepositoryName);
@@ -399,6 +1558,11 @@ int32 UGameplayTagValueSubsystem::GetIntValue(FGameplayTag Tag, int32 DefaultVal
     return GetTypedValue<FIntTagValue>(Tag, DefaultValue, Context);
 }
 
+bool UGameplayTagValueSubsystem::TryGetIntValue(FGameplayTag Tag, int32& OutValue, UObject* Context) const
+{
+    return TryGetTypedValue<FIntTagValue>(Tag, OutValue, Context);
+}
+
 bool UGameplayTagValueSubsystem::SetIntValue(FGameplayTag Tag, int32 Value, FName RepositoryName)
 {
     return SetTypedValue<FIntTagValue>(Tag, Value, RepositoryName);
@@ -409,6 +1573,11 @@ float UGameplayTagValueSubsystem::GetFloatValue(FGameplayTag Tag, float DefaultV
     return GetTypedValue<FFloatTagValue>(Tag, DefaultValue, Context);
 }
 
+bool UGameplayTagValueSubsystem::TryGetFloatValue(FGameplayTag Tag, float& OutValue, UObject* Context) const
+{
+    return TryGetTypedValue<FFloatTagValue>(Tag, OutValue, Context);
+}
+
 bool UGameplayTagValueSubsystem::SetFloatValue(FGameplayTag Tag, float Value, FName RepositoryName)
 {
     return SetTypedValue<FFloatTagValue>(Tag, Value, RepositoryName);
@@ -419,6 +1588,11 @@ FString UGameplayTagValueSubsystem::GetStringValue(FGameplayTag Tag, const FStri
     return GetTypedValue<FStringTagValue>(Tag, DefaultValue, Context);
 }
 
+bool UGameplayTagValueSubsystem::TryGetStringValue(FGameplayTag Tag, FString& OutValue, UObject* Context) const
+{
+    return TryGetTypedValue<FStringTagValue>(Tag, OutValue, Context);
+}
+
 bool UGameplayTagValueSubsystem::SetStringValue(FGameplayTag Tag, const FString& Value, FName RepositoryName)
 {
     return SetTypedValue<FStringTagValue>(Tag, Value, RepositoryName);
@@ -429,6 +1603,11 @@ FTransform UGameplayTagValueSubsystem::GetTransformValue(FGameplayTag Tag, const
     return GetTypedValue<FTransformTagValue>(Tag, DefaultValue, Context);
 }
 
+bool UGameplayTagValueSubsystem::TryGetTransformValue(FGameplayTag Tag, FTransform& OutValue, UObject* Context) const
+{
+    return TryGetTypedValue<FTransformTagValue>(Tag, OutValue, Context);
+}
+
 bool UGameplayTagValueSubsystem::SetTransformValue(FGameplayTag Tag, const FTransform& Value, FName RepositoryName)
 {
     return SetTypedValue<FTransformTagValue>(Tag, Value, RepositoryName);
@@ -439,6 +1618,11 @@ TSoftClassPtr<UObject> UGameplayTagValueSubsystem::GetClassValue(FGameplayTag Ta
     return GetTypedValue<FClassTagValue>(Tag, DefaultValue, Context);
 }
 
+bool UGameplayTagValueSubsystem::TryGetClassValue(FGameplayTag Tag, TSoftClassPtr<UObject>& OutValue, UObject* Context) const
+{
+    return TryGetTypedValue<FClassTagValue>(Tag, OutValue, Context);
+}
+
 bool UGameplayTagValueSubsystem::SetClassValue(FGameplayTag Tag, TSoftClassPtr<UObject> Value, FName RepositoryName)
 {
     return SetTypedValue<FClassTagValue>(Tag, Value, RepositoryName);
@@ -449,6 +1633,11 @@ TSoftObjectPtr<UObject> UGameplayTagValueSubsystem::GetObjectValue(FGameplayTag
     return GetTypedValue<FObjectTagValue>(Tag, DefaultValue, Context);
 }
 
+bool UGameplayTagValueSubsystem::TryGetObjectValue(FGameplayTag Tag, TSoftObjectPtr<UObject>& OutValue, UObject* Context) const
+{
+    return TryGetTypedValue<FObjectTagValue>(Tag, OutValue, Context);
+}
+
 bool UGameplayTagValueSubsystem::SetObjectValue(FGameplayTag Tag, TSoftObjectPtr<UObject> Value, FName RepositoryName)
 {
     return SetTypedValue<FObjectTagValue>(Tag, Value, RepositoryName);
@@ -458,18 +1647,17 @@ bool UGameplayTagValueSubsystem::SetObjectValue(FGameplayTag Tag, TSoftObjectPtr
 // Helper methods
 //------------------------------------------------------------------------------
 
-TSharedPtr<ITagValueRepository> UGameplayTagValueSubsystem::GetBestRepository(FName RepositoryName) const
+ITagValueRepository* UGameplayTagValueSubsystem::GetBestRepository(FName RepositoryName) const
 {
     if (RepositoryName != NAME_None)
     {
         // Get specific repository
-        return GetRepository(RepositoryName);
+        return Repositories.FindRef(RepositoryName).Get();
     }
     else
     {
         // Get highest priority repository
-        TArray<TSharedPtr<ITagValueRepository>> RepositoryArray = GetAllRepositories();
-        return RepositoryArray.Num() > 0 ? RepositoryArray[0] : nullptr;
+        return SortedRepositories.Num() > 0 ? SortedRepositories[0] : nullptr;
     }
 }
 
@@ -540,28 +1728,28 @@ bool UGameplayTagValueSubsystem::TryGetValueFromContext(UObject* Context, FGamep
     return true;
 }
 
-template<typename TagValueType>
-bool UGameplayTagValueSubsystem::TryGetValueFromRepositories(FGameplayTag Tag, typename TagValueType::ValueType& OutValue) const
+template<typename T>
+bool UGameplayTagValueSubsystem::TryGetValueFromRepositories(FGameplayTag Tag, T& OutValue) const
 {
-    TSharedPtr<ITagValueHolder> RawValue = GetRawValue(Tag, nullptr);
-    if (!RawValue.IsValid())
+    if (!Tag.IsValid())
     {
         return false;
     }
     
-    // Try to get the value from the holder
-    void* ValuePtr = RawValue->GetValuePtr();
-    if (!ValuePtr)
-    {
-        return false;
-    }
+    // Read straight from the resolved variant; fails if the stored value is of another type
+    return ResolveTag(Tag).Value.TryGet(OutValue);
+}
+
+template<typename TagValueType>
+bool UGameplayTagValueSubsystem::TryGetTypedValue(FGameplayTag Tag, typename TagValueType::ValueType& OutValue, UObject* Context) const
+{
+    using ValueType = typename TagValueType::ValueType;
+    ValueType Result = OutValue;
     
-    // Check if the value holder is of the correct type
-    if (RawValue->GetValueTypeName() == TagValueType::StaticStruct()->GetFName())
+    // Try to get from context first, then from repositories
+    if (TryGetValueFromContext(Context, Tag, Result, OutValue) || TryGetValueFromRepositories(Tag, Result))
     {
-        // It's the right type, so cast and return the value
-        TagValueType* TypedValue = static_cast<TagValueType*>(ValuePtr);
-        OutValue = TypedValue->Value;
+        OutValue = MoveTemp(Result);
         return true;
     }
     
@@ -569,24 +1757,28 @@ bool UGameplayTagValueSubsystem::TryGetValueFromRepositories(FGameplayTag Tag, t
 }
 
 template<typename TagValueType>
-typename TagValueType::ValueType UGameplayTagValueSubsystem::GetTypedValue(FGameplayTag Tag, const typename TagValueType::ValueType& DefaultValue, UObject* Context) const
+int32 UGameplayTagValueSubsystem::GetTypedValuesForTags(const FGameplayTagContainer& Tags, TMap<FGameplayTag, typename TagValueType::ValueType>& OutValues) const
 {
-    using ValueType = typename TagValueType::ValueType;
-    ValueType Result = DefaultValue;
-    
-    // Try to get from context first
-    if (TryGetValueFromContext(Context, Tag, Result, DefaultValue))
-    {
-        return Result;
-    }
+    OutValues.Reset();
+    OutValues.Reserve(Tags.Num());
     
-    // Try to get from repositories
-    if (TryGetValueFromRepositories<TagValueType>(Tag, Result))
+    typename TagValueType::ValueType Value;
+    for (const FGameplayTag& Tag : Tags)
     {
-        return Result;
+        if (ResolveTag(Tag).Value.TryGet(Value))
+        {
+            OutValues.Add(Tag, Value);
+        }
     }
-    
-    return DefaultValue;
+    return OutValues.Num();
+}
+
+template<typename TagValueType>
+typename TagValueType::ValueType UGameplayTagValueSubsystem::GetTypedValue(FGameplayTag Tag, const typename TagValueType::ValueType& DefaultValue, UObject* Context) const
+{
+    typename TagValueType::ValueType Result = DefaultValue;
+    TryGetTypedValue<TagValueType>(Tag, Result, Context);
+    return Result;
 }
 
 template<typename TagValueType>
@@ -597,8 +1789,8 @@ bool UGameplayTagValueSubsystem::SetTypedValue(FGameplayTag Tag, const typename
         return false;
     }
     
-    TSharedPtr<ITagValueRepository> Repository = GetBestRepository(RepositoryName);
-    if (!Repository.IsValid())
+    ITagValueRepository* Repository = GetBestRepository(RepositoryName);
+    if (!Repository)
     {
         return false;
     }
@@ -621,13 +1813,13 @@ bool UGameplayTagValueSubsystem::TryGetValueFromContext<FTransform>(UObject*, FG
 bool UGameplayTagValueSubsystem::TryGetValueFromContext<TSoftClassPtr<UObject>>(UObject*, FGameplayTag, TSoftClassPtr<UObject>&, const TSoftClassPtr<UObject>&) const;
 bool UGameplayTagValueSubsystem::TryGetValueFromContext<TSoftObjectPtr<UObject>>(UObject*, FGameplayTag, TSoftObjectPtr<UObject>&, const TSoftObjectPtr<UObject>&) const;
 
-bool UGameplayTagValueSubsystem::TryGetValueFromRepositories<FBoolTagValue>(FGameplayTag, bool&) const;
-bool UGameplayTagValueSubsystem::TryGetValueFromRepositories<FIntTagValue>(FGameplayTag, int32&) const;
-bool UGameplayTagValueSubsystem::TryGetValueFromRepositories<FFloatTagValue>(FGameplayTag, float&) const;
-bool UGameplayTagValueSubsystem::TryGetValueFromRepositories<FStringTagValue>(FGameplayTag, FString&) const;
-bool UGameplayTagValueSubsystem::TryGetValueFromRepositories<FTransformTagValue>(FGameplayTag, FTransform&) const;
-bool UGameplayTagValueSubsystem::TryGetValueFromRepositories<FClassTagValue>(FGameplayTag, TSoftClassPtr<UObject>&) const;
-bool UGameplayTagValueSubsystem::TryGetValueFromRepositories<FObjectTagValue>(FGameplayTag, TSoftObjectPtr<UObject>&) const;
+bool UGameplayTagValueSubsystem::TryGetValueFromRepositories<bool>(FGameplayTag, bool&) const;
+bool UGameplayTagValueSubsystem::TryGetValueFromRepositories<int32>(FGameplayTag, int32&) const;
+bool UGameplayTagValueSubsystem::TryGetValueFromRepositories<float>(FGameplayTag, float&) const;
+bool UGameplayTagValueSubsystem::TryGetValueFromRepositories<FString>(FGameplayTag, FString&) const;
+bool UGameplayTagValueSubsystem::TryGetValueFromRepositories<FTransform>(FGameplayTag, FTransform&) const;
+bool UGameplayTagValueSubsystem::TryGetValueFromRepositories<TSoftClassPtr<UObject>>(FGameplayTag, TSoftClassPtr<UObject>&) const;
+bool UGameplayTagValueSubsystem::TryGetValueFromRepositories<TSoftObjectPtr<UObject>>(FGameplayTag, TSoftObjectPtr<UObject>&) const;
 
 bool UGameplayTagValueSubsystem::SetTypedValue<FBoolTagValue>(FGameplayTag, const bool&, FName);
 bool UGameplayTagValueSubsystem::SetTypedValue<FIntTagValue>(FGameplayTag, const int32&, FName);
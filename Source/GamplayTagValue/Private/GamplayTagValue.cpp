@@ -7,6 +7,8 @@
 #include "KismetCompiler.h"
 #include "GameplayTagValueSubsystem.h"
 #include "GameplayTagValueDataAsset.h"
+#include "GameplayTagsModule.h"
+#include "TagValueTagIndex.h"
 #include "Engine/Engine.h"
 #include "Kismet/GameplayStatics.h"
 
@@ -18,6 +20,9 @@
 
 void FGamplayTagValueModule::StartupModule()
 {
+	// Track tag tree changes so code holding dense tag indices can detect that they are stale
+	TagTreeChangedHandle = IGameplayTagsModule::OnGameplayTagTreeChanged.AddStatic(&FTagValueTagIndex::HandleTagTreeChanged);
+
 	// Register custom blueprint nodes
 	RegisterBlueprintNodeFactories();
 
@@ -32,6 +37,8 @@ void FGamplayTagValueModule::ShutdownModule()
 {
 	// Unregister custom blueprint nodes
 	UnregisterBlueprintNodeFactories();
+
+	IGameplayTagsModule::OnGameplayTagTreeChanged.Remove(TagTreeChangedHandle);
 }
 
 void FGamplayTagValueModule::RegisterBlueprintNodeFactories()
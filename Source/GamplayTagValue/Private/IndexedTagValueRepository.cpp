@@ -0,0 +1,161 @@
+// Copyright 2025 Nguyen Phi Hung. All Rights Reserved.
+#include "IndexedTagValueRepository.h"
+#include "GameplayTagsModule.h"
+#include "TagValueTagIndex.h"
+#include "TagValueVariant.h"
+
+FIndexedTagValueRepository::FIndexedTagValueRepository(const FName& InName, int32 InPriority)
+    : RepositoryName(InName)
+    , Priority(InPriority)
+{
+    TagTreeChangedHandle = IGameplayTagsModule::OnGameplayTagTreeChanged.AddRaw(this, &FIndexedTagValueRepository::Reindex);
+    EnableMembershipFilter();
+}
+
+FIndexedTagValueRepository::~FIndexedTagValueRepository()
+{
+    IGameplayTagsModule::OnGameplayTagTreeChanged.Remove(TagTreeChangedHandle);
+}
+
+const FIndexedTagValueRepository::FSlot* FIndexedTagValueRepository::FindSlot(const FGameplayTag& Tag, int32 Index) const
+{
+    if (Index == INDEX_NONE || Index >= Occupied.Num() || !Occupied[Index])
+    {
+        return nullptr;
+    }
+    
+    // The tag check also rejects indices from before a tag tree change
+    const FSlot& Slot = Slots[Index];
+    return Slot.Tag == Tag ? &Slot : nullptr;
+}
+
+bool FIndexedTagValueRepository::HasValue(FGameplayTag Tag) const
+{
+    return FindSlot(Tag, FTagValueTagIndex::GetIndex(Tag)) != nullptr;
+}
+
+TSharedPtr<ITagValueHolder> FIndexedTagValueRepository::GetValue(FGameplayTag Tag) const
+{
+    const FSlot* Slot = FindSlot(Tag, FTagValueTagIndex::GetIndex(Tag));
+    return Slot ? Slot->Value.ToHolder() : nullptr;
+}
+
+bool FIndexedTagValueRepository::TryGetRaw(FGameplayTag Tag, FTagValueVariant& OutValue) const
+{
+    return TryGetRawAt(Tag, FTagValueTagIndex::GetIndex(Tag), OutValue);
+}
+
+bool FIndexedTagValueRepository::TryGetRawAt(FGameplayTag Tag, int32 TagIndex, FTagValueVariant& OutValue) const
+{
+    const FSlot* Slot = FindSlot(Tag, TagIndex);
+    if (!Slot)
+    {
+        OutValue.Reset();
+        return false;
+    }
+    
+    OutValue = Slot->Value;
+    return true;
+}
+
+void FIndexedTagValueRepository::SetValue(FGameplayTag Tag, TSharedPtr<ITagValueHolder> Value)
+{
+    if (!Tag.IsValid())
+    {
+        return;
+    }
+    
+    FTagValueVariant NewValue = FTagValueVariant::FromHolder(Value);
+    if (!NewValue.IsSet())
+    {
+        return;
+    }
+    
+    PlaceValue(Tag, MoveTemp(NewValue));
+}
+
+void FIndexedTagValueRepository::PlaceValue(const FGameplayTag& Tag, FTagValueVariant&& Value)
+{
+    const int32 Index = FTagValueTagIndex::GetIndex(Tag);
+    if (Index == INDEX_NONE)
+    {
+        return;
+    }
+    
+    // Grow to cover the whole index range at once so later writes don't reallocate
+    if (Index >= Slots.Num())
+    {
+        const int32 NewNum = FMath::Max(Index + 1, FTagValueTagIndex::GetNumIndices());
+        Occupied.Add(false, NewNum - Occupied.Num());
+        Slots.SetNum(NewNum);
+    }
+    
+    FSlot& Slot = Slots[Index];
+    Slot.Tag = Tag;
+    Slot.Value = MoveTemp(Value);
+    Occupied[Index] = true;
+    MarkTagPresent(Tag);
+    BumpGeneration();
+}
+
+void FIndexedTagValueRepository::RemoveValue(FGameplayTag Tag)
+{
+    const int32 Index = FTagValueTagIndex::GetIndex(Tag);
+    if (!FindSlot(Tag, Index))
+    {
+        return;
+    }
+    
+    Slots[Index] = FSlot();
+    Occupied[Index] = false;
+    MarkTagAbsent(Tag);
+    BumpGeneration();
+}
+
+void FIndexedTagValueRepository::ClearAllValues()
+{
+    Slots.Empty();
+    Occupied.Empty();
+    ResetMembership();
+    BumpGeneration();
+}
+
+TArray<FGameplayTag> FIndexedTagValueRepository::GetAllTags() const
+{
+    TArray<FGameplayTag> Result;
+    for (TConstSetBitIterator<> It(Occupied); It; ++It)
+    {
+        Result.Add(Slots[It.GetIndex()].Tag);
+    }
+    return Result;
+}
+
+FName FIndexedTagValueRepository::GetRepositoryName() const
+{
+    return RepositoryName;
+}
+
+int32 FIndexedTagValueRepository::GetPriority() const
+{
+    return Priority;
+}
+
+void FIndexedTagValueRepository::Reindex()
+{
+    TArray<FSlot> OldSlots = MoveTemp(Slots);
+    TBitArray<> OldOccupied = MoveTemp(Occupied);
+    
+    Slots.Reset();
+    Occupied.Reset();
+    ResetMembership();
+    
+    for (TConstSetBitIterator<> It(OldOccupied); It; ++It)
+    {
+        FSlot& OldSlot = OldSlots[It.GetIndex()];
+        
+        // Tags that were removed from the tree are dropped here
+        PlaceValue(OldSlot.Tag, MoveTemp(OldSlot.Value));
+    }
+    
+    BumpGeneration();
+}
@@ -0,0 +1,115 @@
+// Copyright 2025 Nguyen Phi Hung. All Rights Reserved.
+#include "ShardedTagValueRepository.h"
+#include "Misc/ScopeRWLock.h"
+#include "TagValueVariant.h"
+
+FShardedTagValueRepository::FShardedTagValueRepository(const FName& InName, int32 InPriority, int32 InNumShards)
+    : RepositoryName(InName)
+    , Priority(InPriority)
+{
+    const int32 NumShards = static_cast<int32>(FMath::RoundUpToPowerOfTwo(static_cast<uint32>(FMath::Max(InNumShards, 1))));
+    Shards = MakeUnique<FShard[]>(NumShards);
+    ShardMask = NumShards - 1;
+}
+
+bool FShardedTagValueRepository::HasValue(FGameplayTag Tag) const
+{
+    const FShard& Shard = GetShard(Tag);
+    FReadScopeLock Lock(Shard.Lock);
+    return Shard.Values.Contains(Tag);
+}
+
+TSharedPtr<ITagValueHolder> FShardedTagValueRepository::GetValue(FGameplayTag Tag) const
+{
+    // Holders are mutable, so callers get a copy; the stored holder is never written after it is added,
+    // so it can be copied after the lock is released
+    TSharedPtr<ITagValueHolder> Holder;
+    {
+        const FShard& Shard = GetShard(Tag);
+        FReadScopeLock Lock(Shard.Lock);
+        if (const TSharedPtr<ITagValueHolder>* Value = Shard.Values.Find(Tag))
+        {
+            Holder = *Value;
+        }
+    }
+    return Holder.IsValid() ? Holder->Clone() : nullptr;
+}
+
+bool FShardedTagValueRepository::TryGetRaw(FGameplayTag Tag, FTagValueVariant& OutValue) const
+{
+    const FShard& Shard = GetShard(Tag);
+    FReadScopeLock Lock(Shard.Lock);
+    const TSharedPtr<ITagValueHolder>* Value = Shard.Values.Find(Tag);
+    OutValue = Value ? FTagValueVariant::FromHolder(*Value) : FTagValueVariant();
+    return OutValue.IsSet();
+}
+
+void FShardedTagValueRepository::SetValue(FGameplayTag Tag, TSharedPtr<ITagValueHolder> Value)
+{
+    if (!Tag.IsValid() || !Value.IsValid())
+    {
+        return;
+    }
+    
+    // Store a copy the caller cannot reach, so other threads never read a holder while it is being written
+    TSharedPtr<ITagValueHolder> Holder = Value->Clone();
+    {
+        FShard& Shard = GetShard(Tag);
+        FWriteScopeLock Lock(Shard.Lock);
+        Shard.Values.Add(Tag, MoveTemp(Holder));
+    }
+    BumpGeneration();
+}
+
+void FShardedTagValueRepository::RemoveValue(FGameplayTag Tag)
+{
+    bool bRemoved;
+    {
+        FShard& Shard = GetShard(Tag);
+        FWriteScopeLock Lock(Shard.Lock);
+        bRemoved = Shard.Values.Remove(Tag) > 0;
+    }
+    
+    if (bRemoved)
+    {
+        BumpGeneration();
+    }
+}
+
+void FShardedTagValueRepository::ClearAllValues()
+{
+    // Shards are cleared one at a time; a concurrent writer may land a value in an already cleared shard
+    for (int32 Index = 0; Index <= ShardMask; ++Index)
+    {
+        FShard& Shard = Shards[Index];
+        FWriteScopeLock Lock(Shard.Lock);
+        Shard.Values.Empty();
+    }
+    BumpGeneration();
+}
+
+TArray<FGameplayTag> FShardedTagValueRepository::GetAllTags() const
+{
+    TArray<FGameplayTag> Result;
+    for (int32 Index = 0; Index <= ShardMask; ++Index)
+    {
+        const FShard& Shard = Shards[Index];
+        FReadScopeLock Lock(Shard.Lock);
+        Result.Reserve(Result.Num() + Shard.Values.Num());
+        for (const TPair<FGameplayTag, TSharedPtr<ITagValueHolder>>& Pair : Shard.Values)
+        {
+            Result.Add(Pair.Key);
+        }
+    }
+    return Result;
+}
+
+FName FShardedTagValueRepository::GetRepositoryName() const
+{
+    return RepositoryName;
+}
+
+int32 FShardedTagValueRepository::GetPriority() const
+{
+    return Priority;
+}
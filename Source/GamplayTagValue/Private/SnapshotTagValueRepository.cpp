@@ -0,0 +1,209 @@
+// Copyright 2025 Nguyen Phi Hung. All Rights Reserved.
+#include "SnapshotTagValueRepository.h"
+#include "GameplayTagsModule.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/ScopeLock.h"
+
+namespace SnapshotTagValueRepository
+{
+    TSharedRef<const FTagValueParentMap, ESPMode::ThreadSafe> MakeParentMap()
+    {
+        TSharedRef<FTagValueParentMap, ESPMode::ThreadSafe> Parents = MakeShared<FTagValueParentMap, ESPMode::ThreadSafe>();
+        Parents->Rebuild();
+        return Parents;
+    }
+}
+
+FSnapshotTagValueRepository::FSnapshotTagValueRepository(const FName& InName, int32 InPriority)
+    : Current(new FSnapshot{ {}, SnapshotTagValueRepository::MakeParentMap() })
+    , RepositoryName(InName)
+    , Priority(InPriority)
+{
+    TagTreeChangedHandle = IGameplayTagsModule::OnGameplayTagTreeChanged.AddRaw(this, &FSnapshotTagValueRepository::HandleTagTreeChanged);
+    EndFrameHandle = FCoreDelegates::OnEndFrame.AddRaw(this, &FSnapshotTagValueRepository::HandleEndFrame);
+}
+
+FSnapshotTagValueRepository::~FSnapshotTagValueRepository()
+{
+    IGameplayTagsModule::OnGameplayTagTreeChanged.Remove(TagTreeChangedHandle);
+    FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+    
+    // The owner guarantees no reader outlives the repository
+    delete Current.load(std::memory_order_relaxed);
+}
+
+bool FSnapshotTagValueRepository::HasValue(FGameplayTag Tag) const
+{
+    const FTagValueReaderEpoch::FReadScope ReadScope(ReaderEpoch);
+    return GetSnapshot().Values.Contains(Tag);
+}
+
+TSharedPtr<ITagValueHolder> FSnapshotTagValueRepository::GetValue(FGameplayTag Tag) const
+{
+    const FTagValueReaderEpoch::FReadScope ReadScope(ReaderEpoch);
+    const FTagValueVariant* Value = GetSnapshot().Values.Find(Tag);
+    if (!Value)
+    {
+        return nullptr;
+    }
+    
+    // Holders are mutable, so out-of-line values are handed out as copies to keep the snapshot immutable
+    const TSharedPtr<ITagValueHolder> Holder = Value->ToHolder();
+    switch (Value->GetType())
+    {
+    case ETagValueType::Bool:
+    case ETagValueType::Int:
+    case ETagValueType::Float:
+        return Holder;
+    default:
+        return Holder->Clone();
+    }
+}
+
+bool FSnapshotTagValueRepository::TryGetRaw(FGameplayTag Tag, FTagValueVariant& OutValue) const
+{
+    const FTagValueReaderEpoch::FReadScope ReadScope(ReaderEpoch);
+    const FTagValueVariant* Value = GetSnapshot().Values.Find(Tag);
+    if (!Value)
+    {
+        OutValue.Reset();
+        return false;
+    }
+    
+    OutValue = *Value;
+    return true;
+}
+
+bool FSnapshotTagValueRepository::TryResolveRaw(FGameplayTag Tag, FTagValueVariant& OutValue) const
+{
+    // The parents come from the same snapshot, so the walk needs neither the tag manager nor the game thread
+    const FTagValueReaderEpoch::FReadScope ReadScope(ReaderEpoch);
+    const FSnapshot& Snapshot = GetSnapshot();
+    for (FGameplayTag CurrentTag = Tag; CurrentTag.IsValid(); CurrentTag = Snapshot.Parents->GetParent(CurrentTag))
+    {
+        if (const FTagValueVariant* Value = Snapshot.Values.Find(CurrentTag))
+        {
+            OutValue = *Value;
+            return true;
+        }
+    }
+    
+    OutValue.Reset();
+    return false;
+}
+
+FTagValueVariant FSnapshotTagValueRepository::MakeImmutableValue(const TSharedPtr<ITagValueHolder>& Holder)
+{
+    if (!Holder.IsValid() || !Holder->IsValid())
+    {
+        return FTagValueVariant();
+    }
+    
+    // The caller keeps its holder and may modify it later, so store a private copy
+    return FTagValueVariant::FromHolder(Holder->Clone());
+}
+
+void FSnapshotTagValueRepository::SetValue(FGameplayTag Tag, TSharedPtr<ITagValueHolder> Value)
+{
+    const TPair<FGameplayTag, TSharedPtr<ITagValueHolder>> Write(Tag, MoveTemp(Value));
+    if (Tag.IsValid() && Write.Value.IsValid())
+    {
+        SetValues(MakeArrayView(&Write, 1));
+    }
+}
+
+void FSnapshotTagValueRepository::SetValues(TArrayView<const TPair<FGameplayTag, TSharedPtr<ITagValueHolder>>> Values)
+{
+    if (Values.IsEmpty())
+    {
+        return;
+    }
+    
+    FScopeLock Lock(&WriterLock);
+    
+    // Only writers replace Current, so holding WriterLock is enough to read it here
+    TUniquePtr<FSnapshot> NextSnapshot = MakeUnique<FSnapshot>(*Current.load(std::memory_order_relaxed));
+    for (const TPair<FGameplayTag, TSharedPtr<ITagValueHolder>>& Write : Values)
+    {
+        if (!Write.Key.IsValid())
+        {
+            continue;
+        }
+        
+        FTagValueVariant Value = MakeImmutableValue(Write.Value);
+        if (Value.IsSet())
+        {
+            NextSnapshot->Values.Add(Write.Key, MoveTemp(Value));
+        }
+        else
+        {
+            NextSnapshot->Values.Remove(Write.Key);
+        }
+    }
+    
+    Publish(MoveTemp(NextSnapshot));
+}
+
+void FSnapshotTagValueRepository::RemoveValue(FGameplayTag Tag)
+{
+    FScopeLock Lock(&WriterLock);
+    
+    // Only writers replace Current, so holding WriterLock is enough to read it here
+    const FSnapshot& CurrentSnapshot = *Current.load(std::memory_order_relaxed);
+    if (!CurrentSnapshot.Values.Contains(Tag))
+    {
+        return;
+    }
+    
+    TUniquePtr<FSnapshot> NextSnapshot = MakeUnique<FSnapshot>(CurrentSnapshot);
+    NextSnapshot->Values.Remove(Tag);
+    Publish(MoveTemp(NextSnapshot));
+}
+
+void FSnapshotTagValueRepository::ClearAllValues()
+{
+    FScopeLock Lock(&WriterLock);
+    Publish(MakeUnique<FSnapshot>(FSnapshot{ {}, Current.load(std::memory_order_relaxed)->Parents }));
+}
+
+void FSnapshotTagValueRepository::HandleTagTreeChanged()
+{
+    FScopeLock Lock(&WriterLock);
+    
+    TUniquePtr<FSnapshot> NextSnapshot = MakeUnique<FSnapshot>(*Current.load(std::memory_order_relaxed));
+    NextSnapshot->Parents = SnapshotTagValueRepository::MakeParentMap();
+    Publish(MoveTemp(NextSnapshot));
+}
+
+void FSnapshotTagValueRepository::HandleEndFrame()
+{
+    FScopeLock Lock(&WriterLock);
+    ReaderEpoch.Reclaim();
+}
+
+void FSnapshotTagValueRepository::Publish(TUniquePtr<const FSnapshot> NextSnapshot)
+{
+    // Readers that loaded the previous snapshot may still be using it, so it is retired rather than deleted
+    const FSnapshot* PreviousSnapshot = Current.exchange(NextSnapshot.Release(), std::memory_order_acq_rel);
+    ReaderEpoch.Retire(TUniquePtr<const FSnapshot>(PreviousSnapshot));
+    BumpGeneration();
+    ReaderEpoch.Reclaim();
+}
+
+TArray<FGameplayTag> FSnapshotTagValueRepository::GetAllTags() const
+{
+    TArray<FGameplayTag> Result;
+    const FTagValueReaderEpoch::FReadScope ReadScope(ReaderEpoch);
+    GetSnapshot().Values.GetKeys(Result);
+    return Result;
+}
+
+FName FSnapshotTagValueRepository::GetRepositoryName() const
+{
+    return RepositoryName;
+}
+
+int32 FSnapshotTagValueRepository::GetPriority() const
+{
+    return Priority;
+}
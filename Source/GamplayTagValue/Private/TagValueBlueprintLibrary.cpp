@@ -112,3 +112,9 @@ void UTagValueBlueprintLibrary::ClearTagValues(FTagValueContainer& Container)
 {
 	Container.Clear();
 }
+
+void UTagValueBlueprintLibrary::SetTagValues(FTagValueContainer& Container, const TArray<FInstancedStruct>& Values)
+{
+	Container.Values = Values;
+	Container.InvalidateTagIndex();
+}
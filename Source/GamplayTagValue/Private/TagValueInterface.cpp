@@ -0,0 +1,78 @@
+// Copyright 2025 Nguyen Phi Hung. All Rights Reserved.
+#include "TagValueInterface.h"
+#include "TagValueVariant.h"
+#include "GameplayTagValueSubsystem.h"
+
+ETagValueType ITagValueHolder::GetValueTypeId() const
+{
+    // Slow path for holders that only report a name
+    const FName TypeName = GetValueTypeName();
+    const TPair<const UScriptStruct*, ETagValueType> BuiltInTypes[] =
+    {
+        { FBoolTagValue::StaticStruct(), ETagValueType::Bool },
+        { FIntTagValue::StaticStruct(), ETagValueType::Int },
+        { FFloatTagValue::StaticStruct(), ETagValueType::Float },
+        { FStringTagValue::StaticStruct(), ETagValueType::String },
+        { FTransformTagValue::StaticStruct(), ETagValueType::Transform },
+        { FClassTagValue::StaticStruct(), ETagValueType::Class },
+        { FObjectTagValue::StaticStruct(), ETagValueType::Object },
+    };
+    
+    for (const TPair<const UScriptStruct*, ETagValueType>& BuiltInType : BuiltInTypes)
+    {
+        if (BuiltInType.Key->GetFName() == TypeName)
+        {
+            return BuiltInType.Value;
+        }
+    }
+    return ETagValueType::None;
+}
+
+bool ITagValueRepository::TryGetRaw(FGameplayTag Tag, FTagValueVariant& OutValue) const
+{
+    // Default implementation goes through the holder-based API
+    OutValue = FTagValueVariant::FromHolder(GetValue(Tag));
+    return OutValue.IsSet();
+}
+
+TSharedPtr<ITagValueRepository> ITagValueRepository::DetachAllValues()
+{
+    // Generic fallback: copy the values out, then clear
+    TSharedPtr<ITagValueRepository> Detached = MakeShared<FMemoryTagValueRepository>(GetRepositoryName(), GetPriority());
+    for (const FGameplayTag& Tag : GetAllTags())
+    {
+        Detached->SetValue(Tag, GetValue(Tag));
+    }
+    ClearAllValues();
+    return Detached;
+}
+
+bool ITagValueRepository::TryGetRawAt(FGameplayTag Tag, int32 TagIndex, FTagValueVariant& OutValue) const
+{
+    return TryGetRaw(Tag, OutValue);
+}
+
+void ITagValueRepository::MarkTagPresent(const FGameplayTag& Tag)
+{
+    if (MembershipFilter.IsValid())
+    {
+        // Indices from before a tag tree change cannot be patched, only rebuilt
+        if (MembershipFilter->IsStale())
+        {
+            MembershipFilter->Rebuild(GetAllTags());
+        }
+        MembershipFilter->Add(Tag);
+    }
+}
+
+void ITagValueRepository::MarkTagAbsent(const FGameplayTag& Tag)
+{
+    if (MembershipFilter.IsValid())
+    {
+        if (MembershipFilter->IsStale())
+        {
+            MembershipFilter->Rebuild(GetAllTags());
+        }
+        MembershipFilter->Remove(Tag);
+    }
+}
@@ -0,0 +1,61 @@
+// Copyright 2025 Nguyen Phi Hung. All Rights Reserved.
+#include "TagValueReaderEpoch.h"
+
+FTagValueReaderEpoch::FReadScope::FReadScope(const FTagValueReaderEpoch& Epoch)
+{
+    // Announce the reader in the counter of the epoch it read, then check that the epoch did not advance
+    // meanwhile. A writer that advanced it in between may have found the counter empty and freed memory
+    // this reader could still reach, so the reader retries in the new epoch. The accesses are sequentially
+    // consistent so that the writer either sees the increment or the reader sees the new epoch.
+    for (;;)
+    {
+        const uint32 CurrentEpoch = Epoch.Epoch.load();
+        Count = &Epoch.ReaderCounts[CurrentEpoch & 1];
+        Count->Num.fetch_add(1);
+        if (Epoch.Epoch.load() == CurrentEpoch)
+        {
+            EnteredEpoch = CurrentEpoch;
+            return;
+        }
+        Count->Num.fetch_sub(1, std::memory_order_release);
+    }
+}
+
+FTagValueReaderEpoch::FReadScope::~FReadScope()
+{
+    // Release, so the reader's loads from retired memory happen before a writer sees the counter drop and frees it
+    Count->Num.fetch_sub(1, std::memory_order_release);
+}
+
+void FTagValueReaderEpoch::Reclaim()
+{
+    // Everything in Draining was unlinked before the epoch was last advanced, so only readers that
+    // entered the previous epoch can still be using it
+    if (Draining.Num() > 0 && ReaderCounts[(Epoch.load(std::memory_order_relaxed) - 1) & 1].Num.load() == 0)
+    {
+        Draining.Reset();
+    }
+    
+    // Readers that enter after the epoch advances can no longer reach what was retired before it
+    if (Draining.Num() == 0 && Retired.Num() > 0)
+    {
+        Swap(Draining, Retired);
+        Epoch.fetch_add(1);
+        
+        if (ReaderCounts[(Epoch.load(std::memory_order_relaxed) - 1) & 1].Num.load() == 0)
+        {
+            Draining.Reset();
+        }
+    }
+}
+
+bool FTagValueReaderEpoch::HasPreviousEpochReaders() const
+{
+    // Sequentially consistent, pairing with the reader's increment and epoch check as in Reclaim
+    return ReaderCounts[(Epoch.load(std::memory_order_relaxed) - 1) & 1].Num.load() != 0;
+}
+
+void FTagValueReaderEpoch::Advance()
+{
+    Epoch.fetch_add(1);
+}
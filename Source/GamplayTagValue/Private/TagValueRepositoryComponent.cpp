@@ -38,6 +38,28 @@ void UTagValueRepositoryComponent::EndPlay(const EEndPlayReason::Type EndPlayRea
 	Super::EndPlay(EndPlayReason);
 }
 
+#if WITH_EDITOR
+void UTagValueRepositoryComponent::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	// The details panel edits the values in place, behind the container's tag index and the subsystem's caches
+	if (PropertyChangedEvent.GetMemberPropertyName() == GET_MEMBER_NAME_CHECKED(UTagValueRepositoryComponent, TagValueContainer))
+	{
+		TagValueContainer.InvalidateTagIndex();
+		BumpGeneration();
+	}
+}
+
+void UTagValueRepositoryComponent::PostEditUndo()
+{
+	Super::PostEditUndo();
+
+	TagValueContainer.InvalidateTagIndex();
+	BumpGeneration();
+}
+#endif
+
 void UTagValueRepositoryComponent::RegisterWithSubsystem()
 {
 	if (bIsRegistered)
@@ -81,12 +103,11 @@ bool UTagValueRepositoryComponent::HasValue(FGameplayTag Tag) const
 
 TSharedPtr<ITagValueHolder> UTagValueRepositoryComponent::GetValue(FGameplayTag Tag) const
 {
-	if (TagValueContainer.HasValue(Tag))
+	// Find the tag in our container
+	if (const FBaseTagValue* BaseValue = TagValueContainer.FindValue(Tag))
 	{
-		// Find the tag in our container
-		const FBaseTagValue BaseValue = TagValueContainer.FindValue(Tag);
-			// Convert the FBaseTagValue to an ITagValueHolder
-		return ConvertTagValueToHolder(BaseValue);
+		// Convert the FBaseTagValue to an ITagValueHolder
+		return ConvertTagValueToHolder(*BaseValue);
 	}
 	return nullptr;
 }
@@ -100,22 +121,27 @@ void UTagValueRepositoryComponent::SetValue(FGameplayTag Tag, TSharedPtr<ITagVal
 		return;
 	}
 
-	// Convert the ITagValueHolder to an FBaseTagValue and add to container
-	TSharedPtr<FBaseTagValue> TagValue = ConvertHolderToTagValue(Value);
+	// Convert the ITagValueHolder to an instanced tag value and add to container
+	FInstancedStruct TagValue = ConvertHolderToTagValue(Value);
 	if (TagValue.IsValid())
 	{
-		TagValueContainer.Values.Add(Tag, TagValue);
+		TagValueContainer.SetInstancedValue(Tag, MoveTemp(TagValue));
+		BumpGeneration();
 	}
 }
 
 void UTagValueRepositoryComponent::RemoveValue(FGameplayTag Tag)
 {
-	TagValueContainer.RemoveValue(Tag);
+	if (TagValueContainer.RemoveValue(Tag))
+	{
+		BumpGeneration();
+	}
 }
 
 void UTagValueRepositoryComponent::ClearAllValues()
 {
 	TagValueContainer.Clear();
+	BumpGeneration();
 }
 
 TArray<FGameplayTag> UTagValueRepositoryComponent::GetAllTags() const
@@ -136,155 +162,106 @@ int32 UTagValueRepositoryComponent::GetPriority() const
 void UTagValueRepositoryComponent::SetBoolTagValue(FGameplayTag InTag, bool InValue)
 {
 	TagValueContainer.SetValue<FBoolTagValue>(InTag, FBoolTagValue(InValue));
+	BumpGeneration();
 }
 
 void UTagValueRepositoryComponent::SetIntTagValue(FGameplayTag InTag, int32 InValue)
 {
 	TagValueContainer.SetValue<FIntTagValue>(InTag, FIntTagValue(InValue));
+	BumpGeneration();
 }
 
 void UTagValueRepositoryComponent::SetFloatTagValue(FGameplayTag InTag, float InValue)
 {
 	TagValueContainer.SetValue<FFloatTagValue>(InTag, FFloatTagValue(InValue));
+	BumpGeneration();
 }
 
 void UTagValueRepositoryComponent::SetStringTagValue(FGameplayTag InTag, const FString& InValue)
 {
 	TagValueContainer.SetValue<FStringTagValue>(InTag, FStringTagValue(InValue));
+	BumpGeneration();
 }
 
 void UTagValueRepositoryComponent::SetTransformTagValue(FGameplayTag InTag, const FTransform& InValue)
 {
 	TagValueContainer.SetValue<FTransformTagValue>(InTag, FTransformTagValue(InValue));
+	BumpGeneration();
 }
 
 void UTagValueRepositoryComponent::SetClassTagValue(FGameplayTag InTag, TSoftClassPtr<UObject> InValue)
 {
 	TagValueContainer.SetValue<FClassTagValue>(InTag, FClassTagValue(InValue));
+	BumpGeneration();
 }
 
 void UTagValueRepositoryComponent::SetObjectTagValue(FGameplayTag InTag, TSoftObjectPtr<UObject> InValue)
 {
 	TagValueContainer.SetValue<FObjectTagValue>(InTag, FObjectTagValue(InValue));
+	BumpGeneration();
 }
 
 void UTagValueRepositoryComponent::RemoveTagValue(FGameplayTag InTag)
 {
-	TagValueContainer.RemoveValue(InTag);
+	RemoveValue(InTag);
 }
 
 void UTagValueRepositoryComponent::ClearTagValues()
 {
-	TagValueContainer.Clear();
+	ClearAllValues();
 }
 
 TSharedPtr<ITagValueHolder> UTagValueRepositoryComponent::ConvertTagValueToHolder(const FBaseTagValue& Value) const
 {
-
-	// Get the type name to determine which holder to create
-	FName TypeName = Value.GetValueType();
-
 	// Create the appropriate holder based on the type
-	if (TypeName == FName("Bool"))
-	{
-		FBoolTagValue TypedValue = Value.TryCast<FBoolTagValue>();
-		return MakeShared<TTagValueHolder<bool>>(TypedValue.Value);
-	}
-	else if (TypeName == FName("Int"))
-	{
-		FIntTagValue TypedValue = Value.TryCast<FIntTagValue>();
-		return MakeShared<TTagValueHolder<int32>>(TypedValue.Value);
-	}
-	else if (TypeName == FName("Float"))
-	{
-		FFloatTagValue TypedValue = Value.TryCast<FFloatTagValue>();
-		return MakeShared<TTagValueHolder<float>>(TypedValue.Value);
-	}
-	else if (TypeName == FName("String"))
-	{
-		FStringTagValue TypedValue = Value.TryCast<FStringTagValue>();
-		return MakeShared<TTagValueHolder<FString>>(TypedValue.Value);
-	}
-	else if (TypeName == FName("Transform"))
-	{
-		FTransformTagValue TypedValue = Value.TryCast<FTransformTagValue>();
-		return MakeShared<TTagValueHolder<FTransform>>(TypedValue.Value);
-	}
-	else if (TypeName == FName("Class"))
-	{
-		FClassTagValue TypedValue = Value.TryCast<FClassTagValue>();
-		return MakeShared<TTagValueHolder<TSoftClassPtr<UObject>>>(TypedValue.Value);
-	}
-	else if (TypeName == FName("Object"))
+	switch (Value.GetValueTypeId())
 	{
-		FObjectTagValue TypedValue = Value.TryCast<FObjectTagValue>();
-		return MakeShared<TTagValueHolder<TSoftObjectPtr<UObject>>>(TypedValue.Value);
+	case ETagValueType::Bool:
+		return MakeShared<TTagValueHolder<FBoolTagValue>>(*Value.TryCast<FBoolTagValue>());
+	case ETagValueType::Int:
+		return MakeShared<TTagValueHolder<FIntTagValue>>(*Value.TryCast<FIntTagValue>());
+	case ETagValueType::Float:
+		return MakeShared<TTagValueHolder<FFloatTagValue>>(*Value.TryCast<FFloatTagValue>());
+	case ETagValueType::String:
+		return MakeShared<TTagValueHolder<FStringTagValue>>(*Value.TryCast<FStringTagValue>());
+	case ETagValueType::Transform:
+		return MakeShared<TTagValueHolder<FTransformTagValue>>(*Value.TryCast<FTransformTagValue>());
+	case ETagValueType::Class:
+		return MakeShared<TTagValueHolder<FClassTagValue>>(*Value.TryCast<FClassTagValue>());
+	case ETagValueType::Object:
+		return MakeShared<TTagValueHolder<FObjectTagValue>>(*Value.TryCast<FObjectTagValue>());
+	default:
+		return nullptr;
 	}
-
-	return nullptr;
 }
 
-TSharedPtr<FBaseTagValue> UTagValueRepositoryComponent::ConvertHolderToTagValue(const TSharedPtr<ITagValueHolder>& Holder) const
+FInstancedStruct UTagValueRepositoryComponent::ConvertHolderToTagValue(const TSharedPtr<ITagValueHolder>& Holder) const
 {
 	if (!Holder || !Holder->IsValid())
 	{
-		return nullptr;
+		return FInstancedStruct();
 	}
 
-	// Check the type of the holder and create the appropriate tag value
-	FName TypeName = Holder->GetValueTypeName();
-
-	// Handle bool values
-	if (TypeName == TBaseStructure<bool>::Get()->GetFName())
-	{
-		bool* Value = static_cast<bool*>(Holder->GetValuePtr());
-		return MakeShared<FBoolTagValue>(*Value);
-	}
-	// Handle int32 values
-	else if (TypeName == TBaseStructure<int32>::Get()->GetFName())
-	{
-		int32* Value = static_cast<int32*>(Holder->GetValuePtr());
-		return MakeShared<FIntTagValue>(*Value);
-	}
-	// Handle float values
-	else if (TypeName == TBaseStructure<float>::Get()->GetFName())
+	// Copy the held tag value struct based on the holder's type id
+	void* ValuePtr = Holder->GetValuePtr();
+	switch (Holder->GetValueTypeId())
 	{
-		float* Value = static_cast<float*>(Holder->GetValuePtr());
-		return MakeShared<FFloatTagValue>(*Value);
+	case ETagValueType::Bool:
+		return FInstancedStruct::Make(*static_cast<FBoolTagValue*>(ValuePtr));
+	case ETagValueType::Int:
+		return FInstancedStruct::Make(*static_cast<FIntTagValue*>(ValuePtr));
+	case ETagValueType::Float:
+		return FInstancedStruct::Make(*static_cast<FFloatTagValue*>(ValuePtr));
+	case ETagValueType::String:
+		return FInstancedStruct::Make(*static_cast<FStringTagValue*>(ValuePtr));
+	case ETagValueType::Transform:
+		return FInstancedStruct::Make(*static_cast<FTransformTagValue*>(ValuePtr));
+	case ETagValueType::Class:
+		return FInstancedStruct::Make(*static_cast<FClassTagValue*>(ValuePtr));
+	case ETagValueType::Object:
+		return FInstancedStruct::Make(*static_cast<FObjectTagValue*>(ValuePtr));
+	default:
+		// Unknown type
+		return FInstancedStruct();
 	}
-	// Handle double values and convert to float
-	else if (TypeName == TBaseStructure<double>::Get()->GetFName())
-	{
-		double* Value = static_cast<double*>(Holder->GetValuePtr());
-		return MakeShared<FFloatTagValue>(static_cast<float>(*Value));
-	}
-	// Handle FString values
-	else if (TypeName == TBaseStructure<FString>::Get()->GetFName())
-	{
-		FString* Value = static_cast<FString*>(Holder->GetValuePtr());
-		return MakeShared<FStringTagValue>(*Value);
-	}
-	// Handle transform values
-	else if (TypeName == TBaseStructure<FTransform>::Get()->GetFName())
-	{
-		FTransform* Value = static_cast<FTransform*>(Holder->GetValuePtr());
-		return MakeShared<FTransformTagValue>(*Value);
-	}
-	// Handle class path values
-	else if (TypeName == TBaseStructure<TSoftClassPtr<UObject>>::Get()->GetFName() || 
-			 TypeName == TBaseStructure<FSoftClassPath>::Get()->GetFName())
-	{
-		auto* Value = static_cast<TSoftClassPtr<UObject>*>(Holder->GetValuePtr());
-		return MakeShared<FClassTagValue>(*Value);
-	}
-	// Handle object path values
-	else if (TypeName == TBaseStructure<TSoftObjectPtr<UObject>>::Get()->GetFName() || 
-			 TypeName == TBaseStructure<FSoftObjectPath>::Get()->GetFName())
-	{
-		auto* Value = static_cast<TSoftObjectPtr<UObject>*>(Holder->GetValuePtr());
-		return MakeShared<FObjectTagValue>(*Value);
-	}
-
-	// Unknown type
-	return nullptr;
 }
@@ -0,0 +1,304 @@
+// Copyright 2025 Nguyen Phi Hung. All Rights Reserved.
+#include "TagValueSubscription.h"
+
+void FTagValueSubscriptionRegistry::FSubscriber::Execute(const FTagValueChangeEvent& Event) const
+{
+    NativeDelegate.ExecuteIfBound(Event);
+    DynamicDelegate.ExecuteIfBound(Event.Tag, Event.RepositoryName);
+}
+
+FString FTagValueSubscriptionRegistry::FSubscriber::Describe() const
+{
+    if (DynamicDelegate.IsBound())
+    {
+        return FString::Printf(TEXT("%s::%s"), *GetNameSafe(DynamicDelegate.GetUObject()), *DynamicDelegate.GetFunctionName().ToString());
+    }
+    
+    FName FunctionName = NAME_None;
+#if USE_DELEGATE_TRYGETBOUNDFUNCTIONNAME
+    FunctionName = NativeDelegate.TryGetBoundFunctionName();
+#endif
+    return FString::Printf(TEXT("%s::%s"), *GetNameSafe(NativeDelegate.GetUObject()), FunctionName.IsNone() ? TEXT("<native>") : *FunctionName.ToString());
+}
+
+FTagValueSubscriptionHandle FTagValueSubscriptionRegistry::Subscribe(FGameplayTag Tag, ETagValueSubscriptionScope Scope, FOnTagValueChangedNative Delegate)
+{
+    if (!Delegate.IsBound())
+    {
+        return FTagValueSubscriptionHandle();
+    }
+    
+    FSubscriber Subscriber;
+    Subscriber.NativeDelegate = MoveTemp(Delegate);
+    return AddSubscriber(Tag, Scope, MoveTemp(Subscriber));
+}
+
+FTagValueSubscriptionHandle FTagValueSubscriptionRegistry::Subscribe(FGameplayTag Tag, ETagValueSubscriptionScope Scope, FOnTagValueChangedDynamic Delegate)
+{
+    if (!Delegate.IsBound())
+    {
+        return FTagValueSubscriptionHandle();
+    }
+    
+    FSubscriber Subscriber;
+    Subscriber.DynamicDelegate = MoveTemp(Delegate);
+    return AddSubscriber(Tag, Scope, MoveTemp(Subscriber));
+}
+
+FTagValueSubscriptionHandle FTagValueSubscriptionRegistry::AddSubscriber(FGameplayTag Tag, ETagValueSubscriptionScope Scope, FSubscriber&& Subscriber)
+{
+    if (!Tag.IsValid())
+    {
+        return FTagValueSubscriptionHandle();
+    }
+    
+    Subscriber.Id = NextId++;
+    const FLocation Location{ Tag, Scope };
+    Locations.Add(Subscriber.Id, Location);
+    
+    const FTagValueSubscriptionHandle Handle(Subscriber.Id);
+    if (DispatchDepth > 0)
+    {
+        // Keep the lists being dispatched stable; the subscription only receives later changes
+        PendingAdditions.Emplace(Location, MoveTemp(Subscriber));
+    }
+    else
+    {
+        GetMap(Scope).FindOrAdd(Tag).Add(MoveTemp(Subscriber));
+    }
+    return Handle;
+}
+
+bool FTagValueSubscriptionRegistry::Unsubscribe(FTagValueSubscriptionHandle Handle)
+{
+    FLocation Location;
+    if (!Locations.RemoveAndCopyValue(Handle.Id, Location))
+    {
+        return false;
+    }
+    
+    // The subscription may have been added during the current dispatch
+    const int32 PendingIndex = PendingAdditions.IndexOfByPredicate([&Handle](const TPair<FLocation, FSubscriber>& Pending)
+    {
+        return Pending.Value.Id == Handle.Id;
+    });
+    if (PendingIndex != INDEX_NONE)
+    {
+        PendingAdditions.RemoveAt(PendingIndex);
+        return true;
+    }
+    
+    FSubscriberMap& Map = GetMap(Location.Scope);
+    TArray<FSubscriber>* Subscribers = Map.Find(Location.Tag);
+    if (!Subscribers)
+    {
+        return true;
+    }
+    
+    const int32 Index = Subscribers->IndexOfByPredicate([&Handle](const FSubscriber& Subscriber)
+    {
+        return Subscriber.Id == Handle.Id;
+    });
+    if (Index == INDEX_NONE)
+    {
+        return true;
+    }
+    
+    if (DispatchDepth > 0)
+    {
+        // Removing now would shift the list being dispatched, and the delegate may be the one
+        // currently executing; disable the entry and destroy it once the dispatch finishes
+        (*Subscribers)[Index].Id = 0;
+        PendingCompaction.Add(Location);
+    }
+    else
+    {
+        Subscribers->RemoveAt(Index);
+        if (Subscribers->IsEmpty())
+        {
+            Map.Remove(Location.Tag);
+        }
+    }
+    return true;
+}
+
+template<typename FunctionType>
+void FTagValueSubscriptionRegistry::ForEachAncestor(FGameplayTag Tag, FunctionType&& Function) const
+{
+    const TArrayView<const FGameplayTag> Chain = AncestorTable ? AncestorTable->GetChain(Tag) : TArrayView<const FGameplayTag>();
+    if (!Chain.IsEmpty())
+    {
+        for (const FGameplayTag& CurrentTag : Chain)
+        {
+            if (!Function(CurrentTag))
+            {
+                return;
+            }
+        }
+    }
+    else
+    {
+        for (FGameplayTag CurrentTag = Tag; CurrentTag.IsValid(); CurrentTag = CurrentTag.RequestDirectParent())
+        {
+            if (!Function(CurrentTag))
+            {
+                return;
+            }
+        }
+    }
+}
+
+void FTagValueSubscriptionRegistry::Dispatch(const FTagValueChangeEvent& Event)
+{
+    if (Locations.IsEmpty() || !Event.Tag.IsValid())
+    {
+        return;
+    }
+    
+    ++DispatchDepth;
+    
+    DispatchToSubscribers(ExactSubscribers, Event.Tag, Event);
+    
+    // Subtree subscribers of the tag itself or of any ancestor also match
+    if (!SubtreeSubscribers.IsEmpty())
+    {
+        ForEachAncestor(Event.Tag, [this, &Event](const FGameplayTag& CurrentTag)
+        {
+            DispatchToSubscribers(SubtreeSubscribers, CurrentTag, Event);
+            return true;
+        });
+    }
+    
+    if (--DispatchDepth == 0)
+    {
+        ApplyPendingChanges();
+    }
+}
+
+void FTagValueSubscriptionRegistry::DispatchCleared(FName RepositoryName, const ITagValueRepository& ClearedValues)
+{
+    if (Locations.IsEmpty())
+    {
+        return;
+    }
+    
+    // Without subtree subscriptions only the subscribed tags can be affected, however many tags were cleared
+    TArray<FGameplayTag> Tags;
+    if (SubtreeSubscribers.IsEmpty())
+    {
+        ExactSubscribers.GenerateKeyArray(Tags);
+    }
+    else
+    {
+        Tags = ClearedValues.GetAllTags();
+    }
+    
+    for (const FGameplayTag& Tag : Tags)
+    {
+        // Earlier subscribers may have unsubscribed the rest
+        if (!HasSubscribers(Tag))
+        {
+            continue;
+        }
+        
+        const TSharedPtr<ITagValueHolder> OldValue = ClearedValues.GetValue(Tag);
+        if (OldValue.IsValid())
+        {
+            Dispatch(FTagValueChangeEvent(Tag, RepositoryName, OldValue.Get(), nullptr));
+        }
+    }
+}
+
+bool FTagValueSubscriptionRegistry::HasSubscribers(FGameplayTag Tag) const
+{
+    if (Locations.IsEmpty() || !Tag.IsValid())
+    {
+        return false;
+    }
+    
+    if (ExactSubscribers.Contains(Tag))
+    {
+        return true;
+    }
+    
+    bool bFound = false;
+    if (!SubtreeSubscribers.IsEmpty())
+    {
+        ForEachAncestor(Tag, [this, &bFound](const FGameplayTag& CurrentTag)
+        {
+            bFound = SubtreeSubscribers.Contains(CurrentTag);
+            return !bFound;
+        });
+    }
+    return bFound;
+}
+
+void FTagValueSubscriptionRegistry::Reset()
+{
+    ExactSubscribers.Empty();
+    SubtreeSubscribers.Empty();
+    Locations.Empty();
+    PendingAdditions.Empty();
+    PendingCompaction.Empty();
+}
+
+FTagValueSubscriptionRegistry::FSubscriberMap& FTagValueSubscriptionRegistry::GetMap(ETagValueSubscriptionScope Scope)
+{
+    return Scope == ETagValueSubscriptionScope::ExactTag ? ExactSubscribers : SubtreeSubscribers;
+}
+
+void FTagValueSubscriptionRegistry::DispatchToSubscribers(const FSubscriberMap& Map, FGameplayTag Key, const FTagValueChangeEvent& Event)
+{
+    const TArray<FSubscriber>* Subscribers = Map.Find(Key);
+    if (!Subscribers)
+    {
+        return;
+    }
+    
+    // The lists do not change shape during a dispatch: additions and removals are deferred
+    for (const FSubscriber& Subscriber : *Subscribers)
+    {
+        if (Subscriber.Id == 0)
+        {
+            continue;
+        }
+        
+        if (SlowSubscriberThreshold <= 0.0)
+        {
+            Subscriber.Execute(Event);
+            continue;
+        }
+        
+        const double StartTime = FPlatformTime::Seconds();
+        Subscriber.Execute(Event);
+        const double Elapsed = FPlatformTime::Seconds() - StartTime;
+        if (Elapsed > SlowSubscriberThreshold)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("Slow tag value subscriber %s took %.2f ms handling %s"),
+                *Subscriber.Describe(), Elapsed * 1000.0, *Event.Tag.ToString());
+        }
+    }
+}
+
+void FTagValueSubscriptionRegistry::ApplyPendingChanges()
+{
+    for (const FLocation& Location : PendingCompaction)
+    {
+        FSubscriberMap& Map = GetMap(Location.Scope);
+        if (TArray<FSubscriber>* Subscribers = Map.Find(Location.Tag))
+        {
+            Subscribers->RemoveAll([](const FSubscriber& Subscriber) { return Subscriber.Id == 0; });
+            if (Subscribers->IsEmpty())
+            {
+                Map.Remove(Location.Tag);
+            }
+        }
+    }
+    PendingCompaction.Reset();
+    
+    for (TPair<FLocation, FSubscriber>& Pending : PendingAdditions)
+    {
+        GetMap(Pending.Key.Scope).FindOrAdd(Pending.Key.Tag).Add(MoveTemp(Pending.Value));
+    }
+    PendingAdditions.Reset();
+}
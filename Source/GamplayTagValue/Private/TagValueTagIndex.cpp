@@ -0,0 +1,275 @@
+// Copyright 2025 Nguyen Phi Hung. All Rights Reserved.
+#include "TagValueTagIndex.h"
+#include "GameplayTagsManager.h"
+#include <atomic>
+
+int32 FTagValueTagIndex::GetIndex(const FGameplayTag& Tag)
+{
+    if (!Tag.IsValid())
+    {
+        return INDEX_NONE;
+    }
+    
+    const UGameplayTagsManager& Manager = UGameplayTagsManager::Get();
+    const FGameplayTagNetIndex NetIndex = Manager.GetNetIndexFromTag(Tag);
+    return NetIndex < Manager.GetInvalidTagNetIndex() ? static_cast<int32>(NetIndex) : INDEX_NONE;
+}
+
+int32 FTagValueTagIndex::GetNumIndices()
+{
+    return static_cast<int32>(UGameplayTagsManager::Get().GetInvalidTagNetIndex());
+}
+
+namespace TagValueTagIndex
+{
+    /** Bumped on every tag tree change; read by worker threads that keep dense indices */
+    static std::atomic<uint32> TreeSerial = 0;
+}
+
+uint32 FTagValueTagIndex::GetTreeSerial()
+{
+    return TagValueTagIndex::TreeSerial.load(std::memory_order_acquire);
+}
+
+void FTagValueTagIndex::HandleTagTreeChanged()
+{
+    TagValueTagIndex::TreeSerial.fetch_add(1, std::memory_order_release);
+}
+
+void FTagValueAncestorTable::Rebuild()
+{
+    Reset();
+    
+    const UGameplayTagsManager& Manager = UGameplayTagsManager::Get();
+    const int32 NumIndices = FTagValueTagIndex::GetNumIndices();
+    
+    ChainOffsets.Reserve(NumIndices + 1);
+    ChainTags.Reserve(NumIndices * 4);
+    
+    for (int32 Index = 0; Index < NumIndices; ++Index)
+    {
+        ChainOffsets.Add(ChainTags.Num());
+        
+        const FGameplayTag Tag = Manager.GetTagFromNetIndex(static_cast<FGameplayTagNetIndex>(Index));
+        for (FGameplayTag CurrentTag = Tag; CurrentTag.IsValid(); CurrentTag = CurrentTag.RequestDirectParent())
+        {
+            ChainTags.Add(CurrentTag);
+        }
+    }
+    ChainOffsets.Add(ChainTags.Num());
+    
+    ChainTags.Shrink();
+    
+    // Invert the chains into descendant lists: count, then fill
+    ChainIndices.SetNumUninitialized(ChainTags.Num());
+    TArray<int32> NumDescendants;
+    NumDescendants.SetNumZeroed(NumIndices);
+    for (int32 TagIndex = 0; TagIndex < NumIndices; ++TagIndex)
+    {
+        if (ChainOffsets[TagIndex] < ChainOffsets[TagIndex + 1])
+        {
+            ChainIndices[ChainOffsets[TagIndex]] = TagIndex;
+        }
+        
+        for (int32 ChainIndex = ChainOffsets[TagIndex] + 1; ChainIndex < ChainOffsets[TagIndex + 1]; ++ChainIndex)
+        {
+            const int32 AncestorIndex = FTagValueTagIndex::GetIndex(ChainTags[ChainIndex]);
+            ChainIndices[ChainIndex] = AncestorIndex;
+            if (AncestorIndex != INDEX_NONE && AncestorIndex < NumIndices)
+            {
+                ++NumDescendants[AncestorIndex];
+            }
+        }
+    }
+    
+    DescendantOffsets.SetNumUninitialized(NumIndices + 1);
+    int32 Offset = 0;
+    for (int32 TagIndex = 0; TagIndex < NumIndices; ++TagIndex)
+    {
+        DescendantOffsets[TagIndex] = Offset;
+        Offset += NumDescendants[TagIndex];
+    }
+    DescendantOffsets[NumIndices] = Offset;
+    
+    DescendantIndices.SetNumUninitialized(Offset);
+    TArray<int32> FillPositions(DescendantOffsets.GetData(), NumIndices);
+    for (int32 TagIndex = 0; TagIndex < NumIndices; ++TagIndex)
+    {
+        for (int32 ChainIndex = ChainOffsets[TagIndex] + 1; ChainIndex < ChainOffsets[TagIndex + 1]; ++ChainIndex)
+        {
+            const int32 AncestorIndex = ChainIndices[ChainIndex];
+            if (AncestorIndex != INDEX_NONE && AncestorIndex < NumIndices)
+            {
+                DescendantIndices[FillPositions[AncestorIndex]++] = TagIndex;
+            }
+        }
+    }
+}
+
+void FTagValueAncestorTable::Reset()
+{
+    ChainOffsets.Reset();
+    ChainTags.Reset();
+    ChainIndices.Reset();
+    DescendantOffsets.Reset();
+    DescendantIndices.Reset();
+}
+
+TArrayView<const FGameplayTag> FTagValueAncestorTable::GetChain(const FGameplayTag& Tag) const
+{
+    return GetChain(Tag, FTagValueTagIndex::GetIndex(Tag));
+}
+
+TArrayView<const FGameplayTag> FTagValueAncestorTable::GetChain(const FGameplayTag& Tag, int32 Index) const
+{
+    if (Index < 0 || Index + 1 >= ChainOffsets.Num())
+    {
+        return TArrayView<const FGameplayTag>();
+    }
+    
+    const int32 Start = ChainOffsets[Index];
+    const int32 End = ChainOffsets[Index + 1];
+    
+    // A chain that does not start with the tag is from before a tag tree change
+    if (Start == End || ChainTags[Start] != Tag)
+    {
+        return TArrayView<const FGameplayTag>();
+    }
+    return TArrayView<const FGameplayTag>(ChainTags.GetData() + Start, End - Start);
+}
+
+TArrayView<const int32> FTagValueAncestorTable::GetChainIndices(TArrayView<const FGameplayTag> Chain) const
+{
+    if (Chain.IsEmpty())
+    {
+        return TArrayView<const int32>();
+    }
+    return TArrayView<const int32>(ChainIndices.GetData() + (Chain.GetData() - ChainTags.GetData()), Chain.Num());
+}
+
+TArrayView<const int32> FTagValueAncestorTable::GetDescendants(const FGameplayTag& Tag) const
+{
+    if (GetChain(Tag).IsEmpty())
+    {
+        return TArrayView<const int32>();
+    }
+    
+    const int32 Index = FTagValueTagIndex::GetIndex(Tag);
+    const int32 Start = DescendantOffsets[Index];
+    return TArrayView<const int32>(DescendantIndices.GetData() + Start, DescendantOffsets[Index + 1] - Start);
+}
+
+FGameplayTag FTagValueAncestorTable::GetTag(int32 Index) const
+{
+    if (Index < 0 || Index >= Num() || ChainOffsets[Index] == ChainOffsets[Index + 1])
+    {
+        return FGameplayTag();
+    }
+    return ChainTags[ChainOffsets[Index]];
+}
+
+void FTagValueParentMap::Rebuild()
+{
+    Parents.Reset();
+    
+    const UGameplayTagsManager& Manager = UGameplayTagsManager::Get();
+    const int32 NumIndices = FTagValueTagIndex::GetNumIndices();
+    Parents.Reserve(NumIndices);
+    for (int32 Index = 0; Index < NumIndices; ++Index)
+    {
+        const FGameplayTag Tag = Manager.GetTagFromNetIndex(static_cast<FGameplayTagNetIndex>(Index));
+        const FGameplayTag Parent = Tag.RequestDirectParent();
+        if (Parent.IsValid())
+        {
+            Parents.Add(Tag, Parent);
+        }
+    }
+}
+
+int32 FTagValueMembershipFilter::GetRootIndex(const FGameplayTag& Tag)
+{
+    const TSharedPtr<FGameplayTagNode> Node = UGameplayTagsManager::Get().FindTagNode(Tag);
+    if (!Node.IsValid())
+    {
+        return INDEX_NONE;
+    }
+    
+    // The topmost parent node is the manager's unnamed root, which is not a tag
+    const FGameplayTagNode* Root = Node.Get();
+    while (Root->GetParentTagNode() && Root->GetParentTagNode()->GetCompleteTag().IsValid())
+    {
+        Root = Root->GetParentTagNode();
+    }
+    return FTagValueTagIndex::GetIndex(Root->GetCompleteTag());
+}
+
+void FTagValueMembershipFilter::Add(const FGameplayTag& Tag)
+{
+    const int32 Index = FTagValueTagIndex::GetIndex(Tag);
+    if (Index == INDEX_NONE)
+    {
+        bSaturated = true;
+        return;
+    }
+    
+    // Grow to cover the whole index range at once so later additions don't reallocate
+    const int32 NumIndices = FMath::Max(Index + 1, FTagValueTagIndex::GetNumIndices());
+    if (Present.Num() < NumIndices)
+    {
+        Present.Add(false, NumIndices - Present.Num());
+        RootPresent.Add(false, NumIndices - RootPresent.Num());
+    }
+    
+    if (Present[Index])
+    {
+        return;
+    }
+    
+    const int32 RootIndex = GetRootIndex(Tag);
+    if (RootIndex == INDEX_NONE || RootIndex >= RootPresent.Num())
+    {
+        bSaturated = true;
+        return;
+    }
+    
+    Present[Index] = true;
+    ++RootCounts.FindOrAdd(RootIndex);
+    RootPresent[RootIndex] = true;
+}
+
+void FTagValueMembershipFilter::Remove(const FGameplayTag& Tag)
+{
+    const int32 Index = FTagValueTagIndex::GetIndex(Tag);
+    if (Index == INDEX_NONE || Index >= Present.Num() || !Present[Index])
+    {
+        return;
+    }
+    
+    Present[Index] = false;
+    
+    const int32 RootIndex = GetRootIndex(Tag);
+    int32* Count = RootCounts.Find(RootIndex);
+    if (Count && --(*Count) == 0)
+    {
+        RootCounts.Remove(RootIndex);
+        RootPresent[RootIndex] = false;
+    }
+}
+
+void FTagValueMembershipFilter::Rebuild(TArrayView<const FGameplayTag> Tags)
+{
+    Reset();
+    for (const FGameplayTag& Tag : Tags)
+    {
+        Add(Tag);
+    }
+}
+
+void FTagValueMembershipFilter::Reset()
+{
+    Present.Reset();
+    RootPresent.Reset();
+    RootCounts.Reset();
+    bSaturated = false;
+    TreeSerial = FTagValueTagIndex::GetTreeSerial();
+}
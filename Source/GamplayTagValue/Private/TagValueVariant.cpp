@@ -0,0 +1,59 @@
+// Copyright 2025 Nguyen Phi Hung. All Rights Reserved.
+#include "TagValueVariant.h"
+
+FTagValueVariant FTagValueVariant::FromHolder(const TSharedPtr<ITagValueHolder>& Holder)
+{
+    FTagValueVariant Result;
+    if (!Holder.IsValid() || !Holder->IsValid())
+    {
+        return Result;
+    }
+    
+    void* ValuePtr = Holder->GetValuePtr();
+    
+    const ETagValueType Type = Holder->GetValueTypeId();
+    switch (Type)
+    {
+    case ETagValueType::Bool:
+        Result.SetBool(static_cast<FBoolTagValue*>(ValuePtr)->Value);
+        break;
+    case ETagValueType::Int:
+        Result.SetInt(static_cast<FIntTagValue*>(ValuePtr)->Value);
+        break;
+    case ETagValueType::Float:
+        Result.SetFloat(static_cast<FFloatTagValue*>(ValuePtr)->Value);
+        break;
+    case ETagValueType::String:
+    case ETagValueType::Transform:
+    case ETagValueType::Class:
+    case ETagValueType::Object:
+        Result.TypeId = Type;
+        Result.Boxed = Holder;
+        break;
+    default:
+        // Unknown type
+        break;
+    }
+    
+    return Result;
+}
+
+TSharedPtr<ITagValueHolder> FTagValueVariant::ToHolder() const
+{
+    if (!IsSet())
+    {
+        return nullptr;
+    }
+    
+    switch (GetType())
+    {
+    case ETagValueType::Bool:
+        return MakeShared<TTagValueHolder<FBoolTagValue>>(FBoolTagValue(BoolValue));
+    case ETagValueType::Int:
+        return MakeShared<TTagValueHolder<FIntTagValue>>(FIntTagValue(IntValue));
+    case ETagValueType::Float:
+        return MakeShared<TTagValueHolder<FFloatTagValue>>(FFloatTagValue(FloatValue));
+    default:
+        return Boxed;
+    }
+}
@@ -0,0 +1,99 @@
+// Copyright 2025 Nguyen Phi Hung. All Rights Reserved.
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "GameplayTagValueSubsystem.h"
+#include "IndexedTagValueRepository.h"
+#include "TagValueTestHelpers.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FIndexedTagValueRepositoryReadTest, "GamplayTagValue.IndexedRepository.Read",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FIndexedTagValueRepositoryReadTest::RunTest(const FString& Parameters)
+{
+    const TArray<FGameplayTag> Tags = TagValueTestTags::GetLeafTags();
+    FIndexedTagValueRepository Repository(TEXT("Indexed"), 0);
+    for (int32 Index = 0; Index < Tags.Num(); ++Index)
+    {
+        Repository.SetValue(Tags[Index], MakeShared<TTagValueHolder<FIntTagValue>>(FIntTagValue(Index)));
+    }
+    
+    for (int32 Index = 0; Index < Tags.Num(); ++Index)
+    {
+        const FTagValueIndexedTag IndexedTag(Tags[Index]);
+        FTagValueVariant ByTag;
+        FTagValueVariant ByIndex;
+        int32 Value = INDEX_NONE;
+        TestTrue(TEXT("Read by tag"), Repository.TryGetRaw(Tags[Index], ByTag) && ByTag.TryGet(Value) && Value == Index);
+        TestTrue(TEXT("Read by cached index"), Repository.TryGetRawAt(IndexedTag.GetTag(), IndexedTag.GetIndex(), ByIndex) && ByIndex.TryGet(Value) && Value == Index);
+    }
+    
+    // An index that belongs to another tag must not return that tag's value
+    const FTagValueIndexedTag Other(Tags[1]);
+    FTagValueVariant Mismatch;
+    TestFalse(TEXT("Index of another tag is rejected"), Repository.TryGetRawAt(Tags[0], Other.GetIndex(), Mismatch));
+    
+    Repository.RemoveValue(Tags[0]);
+    TestFalse(TEXT("Removed value is gone"), Repository.HasValue(Tags[0]));
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FIndexedTagValueRepositoryBenchmark, "GamplayTagValue.Performance.IndexedRepository",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FIndexedTagValueRepositoryBenchmark::RunTest(const FString& Parameters)
+{
+    constexpr int32 NumReads = 4 * 1024 * 1024;
+    
+    const TArray<FGameplayTag> Tags = TagValueTestTags::GetLeafTags();
+    TArray<FTagValueIndexedTag> IndexedTags;
+    FMemoryTagValueRepository MapRepository(TEXT("Map"), 0);
+    FIndexedTagValueRepository IndexedRepository(TEXT("Indexed"), 0);
+    for (int32 Index = 0; Index < Tags.Num(); ++Index)
+    {
+        const TSharedPtr<ITagValueHolder> Value = MakeShared<TTagValueHolder<FIntTagValue>>(FIntTagValue(Index));
+        MapRepository.SetValue(Tags[Index], Value);
+        IndexedRepository.SetValue(Tags[Index], Value);
+        IndexedTags.Emplace(Tags[Index]);
+    }
+    
+    // Summing the values keeps the reads from being optimized away and checks that they all hit
+    int64 Expected = 0;
+    for (int32 Read = 0; Read < NumReads; ++Read)
+    {
+        Expected += Read % Tags.Num();
+    }
+    
+    auto TimeReads = [&](const TCHAR* Name, auto&& ReadValue)
+    {
+        int64 Sum = 0;
+        const double Nanoseconds = TagValueBenchmark::TimeNanosecondsPerCall(NumReads, [&](int32 Read)
+        {
+            FTagValueVariant Value;
+            int32 IntValue = 0;
+            if (ReadValue(Read % Tags.Num(), Value) && Value.TryGet(IntValue))
+            {
+                Sum += IntValue;
+            }
+        });
+        TestEqual(FString::Printf(TEXT("%s reads found every value"), Name), Sum, Expected);
+        AddInfo(FString::Printf(TEXT("%s: %.2f ns per read"), Name, Nanoseconds));
+    };
+    
+    TimeReads(TEXT("Map repository"), [&](int32 Index, FTagValueVariant& OutValue)
+    {
+        return MapRepository.TryGetRaw(Tags[Index], OutValue);
+    });
+    TimeReads(TEXT("Indexed repository by tag"), [&](int32 Index, FTagValueVariant& OutValue)
+    {
+        return IndexedRepository.TryGetRaw(Tags[Index], OutValue);
+    });
+    TimeReads(TEXT("Indexed repository by cached index"), [&](int32 Index, FTagValueVariant& OutValue)
+    {
+        return IndexedRepository.TryGetRawAt(IndexedTags[Index].GetTag(), IndexedTags[Index].GetIndex(), OutValue);
+    });
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,155 @@
+// Copyright 2025 Nguyen Phi Hung. All Rights Reserved.
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "ShardedTagValueRepository.h"
+#include "TagValueTestHelpers.h"
+#include "TagValueVariant.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FShardedTagValueRepositoryGenerationTest, "GamplayTagValue.ShardedRepository.ConcurrentGeneration",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FShardedTagValueRepositoryGenerationTest::RunTest(const FString& Parameters)
+{
+    constexpr int32 NumThreads = 8;
+    constexpr int32 NumWritesPerThread = 20000;
+    
+    const TArray<FGameplayTag> Tags = TagValueTestTags::GetLeafTags();
+    FShardedTagValueRepository Repository(TEXT("Sharded"), 0);
+    const uint32 GenerationBefore = Repository.GetGeneration();
+    
+    // Every set bumps the generation, so a lost increment shows up as a short count
+    TagValueStress::RunOnThreads(NumThreads, [&](int32 ThreadIndex)
+    {
+        const FGameplayTag& Tag = Tags[ThreadIndex % Tags.Num()];
+        for (int32 Write = 0; Write < NumWritesPerThread; ++Write)
+        {
+            Repository.SetValue(Tag, MakeShared<TTagValueHolder<FIntTagValue>>(FIntTagValue(Write)));
+        }
+    });
+    
+    TestEqual(TEXT("Every concurrent write bumped the generation"), Repository.GetGeneration() - GenerationBefore, static_cast<uint32>(NumThreads * NumWritesPerThread));
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FShardedTagValueRepositoryTornValueTest, "GamplayTagValue.ShardedRepository.TornValues",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FShardedTagValueRepositoryTornValueTest::RunTest(const FString& Parameters)
+{
+    constexpr int32 NumReaders = 4;
+    constexpr int32 NumWrites = 20000;
+    
+    const TArray<FGameplayTag> Leaves = TagValueTestTags::GetLeafTags();
+    FShardedTagValueRepository Repository(TEXT("Sharded"), 0);
+    
+    // The writer reuses its holders, so a repository that kept them would be read while they are rewritten
+    TSharedPtr<TTagValueHolder<FTransformTagValue>> TransformHolder = MakeShared<TTagValueHolder<FTransformTagValue>>(FTransformTagValue(TagValueStress::MakeUniformTransform(0)));
+    TSharedPtr<TTagValueHolder<FStringTagValue>> StringHolder = MakeShared<TTagValueHolder<FStringTagValue>>(FStringTagValue(TagValueStress::MakeUniformString(0)));
+    Repository.SetValue(Leaves[0], TransformHolder);
+    Repository.SetValue(Leaves[1], StringHolder);
+    
+    std::atomic<int32> NumTorn = 0;
+    std::atomic<int32> NumMissing = 0;
+    std::atomic<int64> NumReads = 0;
+    TagValueStress::RunWriterWithReaders(NumReaders, [&]()
+    {
+        for (int32 Write = 1; Write <= NumWrites; ++Write)
+        {
+            TransformHolder->Value = FTransformTagValue(TagValueStress::MakeUniformTransform(Write));
+            StringHolder->Value = FStringTagValue(TagValueStress::MakeUniformString(Write));
+            Repository.SetValue(Leaves[0], TransformHolder);
+            Repository.SetValue(Leaves[1], StringHolder);
+        }
+    },
+    [&](int32 ReaderIndex)
+    {
+        FTagValueVariant RawTransform;
+        FTagValueVariant RawString;
+        FTransform Transform;
+        FString String;
+        const TSharedPtr<ITagValueHolder> Holder = Repository.GetValue(Leaves[ReaderIndex % 2]);
+        if (!Holder.IsValid() || !Repository.TryGetRaw(Leaves[0], RawTransform) || !RawTransform.TryGet(Transform)
+            || !Repository.TryGetRaw(Leaves[1], RawString) || !RawString.TryGet(String))
+        {
+            NumMissing.fetch_add(1, std::memory_order_relaxed);
+        }
+        else if (!TagValueStress::IsUniformTransform(Transform) || !TagValueStress::IsUniformString(String))
+        {
+            NumTorn.fetch_add(1, std::memory_order_relaxed);
+        }
+        
+        // Readers scribble over what they were handed, which must be their own copy
+        if (Holder.IsValid() && Holder->GetValueTypeId() == ETagValueType::String)
+        {
+            static_cast<FStringTagValue*>(Holder->GetValuePtr())->Value = FString::ChrN(16, TEXT('z'));
+        }
+        else if (Holder.IsValid())
+        {
+            static_cast<FTransformTagValue*>(Holder->GetValuePtr())->Value = FTransform(FVector(1.0, 2.0, 3.0));
+        }
+        NumReads.fetch_add(1, std::memory_order_relaxed);
+    });
+    
+    TestEqual(TEXT("No read saw a torn value"), NumTorn.load(), 0);
+    TestEqual(TEXT("No read missed a value"), NumMissing.load(), 0);
+    AddInfo(FString::Printf(TEXT("%lld reads raced %d writes"), NumReads.load(), NumWrites));
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FShardedTagValueRepositoryScalingBenchmark, "GamplayTagValue.Performance.ShardedRepositoryScaling",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FShardedTagValueRepositoryScalingBenchmark::RunTest(const FString& Parameters)
+{
+    constexpr int32 NumOperationsPerThread = 256 * 1024;
+    constexpr int32 WriteEvery = 4;
+    
+    const TArray<FGameplayTag> Tags = TagValueTestTags::GetLeafTags();
+    double SingleThreadRate = 0.0;
+    for (const int32 NumThreads : { 1, 2, 4, 8, 16 })
+    {
+        FShardedTagValueRepository Repository(TEXT("Sharded"), 0);
+        for (int32 Index = 0; Index < Tags.Num(); ++Index)
+        {
+            Repository.SetValue(Tags[Index], MakeShared<TTagValueHolder<FIntTagValue>>(FIntTagValue(Index)));
+        }
+        
+        // Each thread writes its own tag and reads all of them, so threads share shards but not tags
+        std::atomic<int32> NumMissing = 0;
+        const double Seconds = TagValueStress::RunOnThreads(NumThreads, [&](int32 ThreadIndex)
+        {
+            const FGameplayTag& OwnTag = Tags[ThreadIndex % Tags.Num()];
+            int32 Missing = 0;
+            for (int32 Operation = 0; Operation < NumOperationsPerThread; ++Operation)
+            {
+                if (Operation % WriteEvery == 0)
+                {
+                    Repository.SetValue(OwnTag, MakeShared<TTagValueHolder<FIntTagValue>>(FIntTagValue(Operation)));
+                }
+                else
+                {
+                    FTagValueVariant Value;
+                    Missing += Repository.TryGetRaw(Tags[Operation % Tags.Num()], Value) ? 0 : 1;
+                }
+            }
+            NumMissing.fetch_add(Missing, std::memory_order_relaxed);
+        });
+        
+        const double OperationsPerSecond = NumThreads * NumOperationsPerThread / FMath::Max(Seconds, UE_DOUBLE_SMALL_NUMBER);
+        if (NumThreads == 1)
+        {
+            SingleThreadRate = OperationsPerSecond;
+        }
+        
+        TestEqual(FString::Printf(TEXT("%d threads found every value"), NumThreads), NumMissing.load(), 0);
+        TestEqual(FString::Printf(TEXT("%d threads bumped the generation once per write"), NumThreads), Repository.GetGeneration(),
+            static_cast<uint32>(Tags.Num() + NumThreads * (NumOperationsPerThread / WriteEvery)));
+        AddInfo(FString::Printf(TEXT("%2d threads: %.2f M operations per second (%.2fx one thread)"), NumThreads,
+            OperationsPerSecond / 1.0e6, OperationsPerSecond / FMath::Max(SingleThreadRate, UE_DOUBLE_SMALL_NUMBER)));
+    }
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,80 @@
+// Copyright 2025 Nguyen Phi Hung. All Rights Reserved.
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "SnapshotTagValueRepository.h"
+#include "TagValueTestHelpers.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSnapshotTagValueRepositoryResolveTest, "GamplayTagValue.SnapshotRepository.Resolve",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FSnapshotTagValueRepositoryResolveTest::RunTest(const FString& Parameters)
+{
+    const TArray<FGameplayTag> Groups = TagValueTestTags::GetGroupTags();
+    const TArray<FGameplayTag> Leaves = TagValueTestTags::GetLeafTags();
+    FSnapshotTagValueRepository Repository(TEXT("Snapshot"), 0);
+    Repository.SetValue(Groups[0], MakeShared<TTagValueHolder<FIntTagValue>>(FIntTagValue(1)));
+    Repository.SetValue(Leaves[1], MakeShared<TTagValueHolder<FIntTagValue>>(FIntTagValue(2)));
+    
+    FTagValueVariant Value;
+    int32 IntValue = 0;
+    TestTrue(TEXT("Leaf without a value inherits from its group"), Repository.TryResolveRaw(Leaves[0], Value) && Value.TryGet(IntValue) && IntValue == 1);
+    TestTrue(TEXT("Leaf with a value uses its own"), Repository.TryResolveRaw(Leaves[1], Value) && Value.TryGet(IntValue) && IntValue == 2);
+    TestFalse(TEXT("Leaf of another group finds nothing"), Repository.TryResolveRaw(Leaves[4], Value));
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSnapshotTagValueRepositoryTornValueTest, "GamplayTagValue.SnapshotRepository.TornValues",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FSnapshotTagValueRepositoryTornValueTest::RunTest(const FString& Parameters)
+{
+    constexpr int32 NumReaders = 4;
+    constexpr int32 NumWrites = 20000;
+    
+    const TArray<FGameplayTag> Groups = TagValueTestTags::GetGroupTags();
+    const TArray<FGameplayTag> Leaves = TagValueTestTags::GetLeafTags();
+    FSnapshotTagValueRepository Repository(TEXT("Snapshot"), 0);
+    Repository.SetValue(Leaves[0], MakeShared<TTagValueHolder<FTransformTagValue>>(FTransformTagValue(TagValueStress::MakeUniformTransform(0))));
+    Repository.SetValue(Leaves[1], MakeShared<TTagValueHolder<FStringTagValue>>(FStringTagValue(TagValueStress::MakeUniformString(0))));
+    Repository.SetValue(Groups[1], MakeShared<TTagValueHolder<FIntTagValue>>(FIntTagValue(0)));
+    
+    std::atomic<int32> NumTorn = 0;
+    std::atomic<int32> NumMissing = 0;
+    std::atomic<int64> NumReads = 0;
+    TagValueStress::RunWriterWithReaders(NumReaders, [&]()
+    {
+        // Every write retires the snapshot readers may be inside, so reclamation keeps racing the reads
+        for (int32 Write = 1; Write <= NumWrites; ++Write)
+        {
+            Repository.SetValue(Leaves[0], MakeShared<TTagValueHolder<FTransformTagValue>>(FTransformTagValue(TagValueStress::MakeUniformTransform(Write))));
+            Repository.SetValue(Leaves[1], MakeShared<TTagValueHolder<FStringTagValue>>(FStringTagValue(TagValueStress::MakeUniformString(Write))));
+            Repository.SetValue(Groups[1], MakeShared<TTagValueHolder<FIntTagValue>>(FIntTagValue(Write)));
+        }
+    },
+    [&](int32 ReaderIndex)
+    {
+        FTransform Transform;
+        FString String;
+        FTagValueVariant Inherited;
+        int32 IntValue = 0;
+        if (!Repository.TryGetTypedValue(Leaves[0], Transform) || !Repository.TryGetTypedValue(Leaves[1], String)
+            || !Repository.TryResolveRaw(Leaves[4 + ReaderIndex % 4], Inherited) || !Inherited.TryGet(IntValue))
+        {
+            NumMissing.fetch_add(1, std::memory_order_relaxed);
+        }
+        else if (!TagValueStress::IsUniformTransform(Transform) || !TagValueStress::IsUniformString(String))
+        {
+            NumTorn.fetch_add(1, std::memory_order_relaxed);
+        }
+        NumReads.fetch_add(1, std::memory_order_relaxed);
+    });
+    
+    TestEqual(TEXT("No read saw a torn value"), NumTorn.load(), 0);
+    TestEqual(TEXT("No read missed a value"), NumMissing.load(), 0);
+    AddInfo(FString::Printf(TEXT("%lld reads raced %d writes"), NumReads.load(), NumWrites));
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
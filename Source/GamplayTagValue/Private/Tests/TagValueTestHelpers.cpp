@@ -0,0 +1,58 @@
+// Copyright 2025 Nguyen Phi Hung. All Rights Reserved.
+#include "TagValueTestHelpers.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace TagValueTestTags
+{
+    UE_DEFINE_GAMEPLAY_TAG(Root, "GamplayTagValue.Test");
+    UE_DEFINE_GAMEPLAY_TAG_STATIC(Group0, "GamplayTagValue.Test.Group0");
+    UE_DEFINE_GAMEPLAY_TAG_STATIC(Group1, "GamplayTagValue.Test.Group1");
+    UE_DEFINE_GAMEPLAY_TAG_STATIC(Group2, "GamplayTagValue.Test.Group2");
+    UE_DEFINE_GAMEPLAY_TAG_STATIC(Group3, "GamplayTagValue.Test.Group3");
+    UE_DEFINE_GAMEPLAY_TAG_STATIC(Group0Leaf0, "GamplayTagValue.Test.Group0.Leaf0");
+    UE_DEFINE_GAMEPLAY_TAG_STATIC(Group0Leaf1, "GamplayTagValue.Test.Group0.Leaf1");
+    UE_DEFINE_GAMEPLAY_TAG_STATIC(Group0Leaf2, "GamplayTagValue.Test.Group0.Leaf2");
+    UE_DEFINE_GAMEPLAY_TAG_STATIC(Group0Leaf3, "GamplayTagValue.Test.Group0.Leaf3");
+    UE_DEFINE_GAMEPLAY_TAG_STATIC(Group1Leaf0, "GamplayTagValue.Test.Group1.Leaf0");
+    UE_DEFINE_GAMEPLAY_TAG_STATIC(Group1Leaf1, "GamplayTagValue.Test.Group1.Leaf1");
+    UE_DEFINE_GAMEPLAY_TAG_STATIC(Group1Leaf2, "GamplayTagValue.Test.Group1.Leaf2");
+    UE_DEFINE_GAMEPLAY_TAG_STATIC(Group1Leaf3, "GamplayTagValue.Test.Group1.Leaf3");
+    UE_DEFINE_GAMEPLAY_TAG_STATIC(Group2Leaf0, "GamplayTagValue.Test.Group2.Leaf0");
+    UE_DEFINE_GAMEPLAY_TAG_STATIC(Group2Leaf1, "GamplayTagValue.Test.Group2.Leaf1");
+    UE_DEFINE_GAMEPLAY_TAG_STATIC(Group2Leaf2, "GamplayTagValue.Test.Group2.Leaf2");
+    UE_DEFINE_GAMEPLAY_TAG_STATIC(Group2Leaf3, "GamplayTagValue.Test.Group2.Leaf3");
+    UE_DEFINE_GAMEPLAY_TAG_STATIC(Group3Leaf0, "GamplayTagValue.Test.Group3.Leaf0");
+    UE_DEFINE_GAMEPLAY_TAG_STATIC(Group3Leaf1, "GamplayTagValue.Test.Group3.Leaf1");
+    UE_DEFINE_GAMEPLAY_TAG_STATIC(Group3Leaf2, "GamplayTagValue.Test.Group3.Leaf2");
+    UE_DEFINE_GAMEPLAY_TAG_STATIC(Group3Leaf3, "GamplayTagValue.Test.Group3.Leaf3");
+    
+    TArray<FGameplayTag> GetGroupTags()
+    {
+        return { Group0, Group1, Group2, Group3 };
+    }
+    
+    TArray<FGameplayTag> GetLeafTags()
+    {
+        return {
+            Group0Leaf0,
+            Group0Leaf1,
+            Group0Leaf2,
+            Group0Leaf3,
+            Group1Leaf0,
+            Group1Leaf1,
+            Group1Leaf2,
+            Group1Leaf3,
+            Group2Leaf0,
+            Group2Leaf1,
+            Group2Leaf2,
+            Group2Leaf3,
+            Group3Leaf0,
+            Group3Leaf1,
+            Group3Leaf2,
+            Group3Leaf3
+        };
+    }
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,145 @@
+// Copyright 2025 Nguyen Phi Hung. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Async/Async.h"
+#include "NativeGameplayTags.h"
+#include <atomic>
+
+/**
+ * Native tags registered for the automation tests
+ * GamplayTagValue.Test has four groups of four leaves each, so tests can exercise both exact and inherited lookups.
+ */
+namespace TagValueTestTags
+{
+    UE_DECLARE_GAMEPLAY_TAG_EXTERN(Root);
+    
+    /** @return The four group tags directly below the root */
+    TArray<FGameplayTag> GetGroupTags();
+    
+    /** @return The sixteen leaf tags, grouped by parent */
+    TArray<FGameplayTag> GetLeafTags();
+}
+
+namespace TagValueBenchmark
+{
+    /**
+     * Time a loop of operations
+     * @param NumIterations How many times to call Operation
+     * @param Operation Called with the iteration index
+     * @return Average nanoseconds per call
+     */
+    template<typename OperationType>
+    double TimeNanosecondsPerCall(int32 NumIterations, OperationType&& Operation)
+    {
+        const double StartTime = FPlatformTime::Seconds();
+        for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+        {
+            Operation(Iteration);
+        }
+        return (FPlatformTime::Seconds() - StartTime) * 1.0e9 / FMath::Max(NumIterations, 1);
+    }
+}
+
+namespace TagValueStress
+{
+    /**
+     * Read on several threads for as long as a writer runs on the calling thread
+     * @param NumReaders Number of reader threads
+     * @param Write Called once on the calling thread
+     * @param Read Called over and over on each reader thread, with the reader's index, until Write returns
+     */
+    template<typename WriteType, typename ReadType>
+    void RunWriterWithReaders(int32 NumReaders, WriteType&& Write, ReadType&& Read)
+    {
+        std::atomic<bool> bWriterDone = false;
+        TArray<TFuture<void>> Readers;
+        for (int32 ReaderIndex = 0; ReaderIndex < NumReaders; ++ReaderIndex)
+        {
+            Readers.Add(Async(EAsyncExecution::Thread, [&bWriterDone, &Read, ReaderIndex]()
+            {
+                while (!bWriterDone.load(std::memory_order_acquire))
+                {
+                    Read(ReaderIndex);
+                }
+            }));
+        }
+        
+        Write();
+        bWriterDone.store(true, std::memory_order_release);
+        for (TFuture<void>& Reader : Readers)
+        {
+            Reader.Wait();
+        }
+    }
+    
+    /**
+     * Run the same work on several threads at once and wait for all of them
+     * @param NumThreads Number of threads
+     * @param Work Called once on each thread, with the thread's index
+     * @return Wall-clock seconds from starting the first thread to the last one finishing
+     */
+    template<typename WorkType>
+    double RunOnThreads(int32 NumThreads, WorkType&& Work)
+    {
+        // Threads wait for the go signal, so thread start-up is not part of the measured work
+        std::atomic<int32> NumReady = 0;
+        std::atomic<bool> bGo = false;
+        TArray<TFuture<void>> Threads;
+        for (int32 ThreadIndex = 0; ThreadIndex < NumThreads; ++ThreadIndex)
+        {
+            Threads.Add(Async(EAsyncExecution::Thread, [&NumReady, &bGo, &Work, ThreadIndex]()
+            {
+                NumReady.fetch_add(1, std::memory_order_acq_rel);
+                while (!bGo.load(std::memory_order_acquire))
+                {
+                    FPlatformProcess::YieldThread();
+                }
+                Work(ThreadIndex);
+            }));
+        }
+        
+        while (NumReady.load(std::memory_order_acquire) < NumThreads)
+        {
+            FPlatformProcess::YieldThread();
+        }
+        const double StartTime = FPlatformTime::Seconds();
+        bGo.store(true, std::memory_order_release);
+        for (TFuture<void>& Thread : Threads)
+        {
+            Thread.Wait();
+        }
+        return FPlatformTime::Seconds() - StartTime;
+    }
+    
+    /** @return A transform whose translation components all equal Value, so a torn copy is easy to spot */
+    inline FTransform MakeUniformTransform(int32 Value)
+    {
+        return FTransform(FVector(Value, Value, Value));
+    }
+    
+    /** @return True if a transform made by MakeUniformTransform was read whole */
+    inline bool IsUniformTransform(const FTransform& Transform)
+    {
+        const FVector Translation = Transform.GetTranslation();
+        return Translation.X == Translation.Y && Translation.Y == Translation.Z;
+    }
+    
+    /** @return A string of one repeated character, so a torn copy is easy to spot */
+    inline FString MakeUniformString(int32 Value)
+    {
+        return FString::ChrN(32, TEXT('a') + Value % 26);
+    }
+    
+    /** @return True if a string made by MakeUniformString was read whole */
+    inline bool IsUniformString(const FString& String)
+    {
+        return String.Len() == 32 && String == FString::ChrN(32, String[0]);
+    }
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,121 @@
+// Copyright 2025 Nguyen Phi Hung. All Rights Reserved.
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "TagValueInterface.h"
+#include "TagValueTestHelpers.h"
+#include "TagValueVariant.h"
+
+namespace TagValueTypeIdTests
+{
+    /** A holder written against the interface before type ids existed: it only reports a name */
+    class FNameOnlyIntHolder : public ITagValueHolder
+    {
+    public:
+        explicit FNameOnlyIntHolder(int32 InValue) : Value(InValue) {}
+        
+        virtual void* GetValuePtr() override { return &Value; }
+        virtual FName GetValueTypeName() const override { return FIntTagValue::StaticStruct()->GetFName(); }
+        virtual TSharedPtr<ITagValueHolder> Clone() const override { return MakeShared<FNameOnlyIntHolder>(Value.Value); }
+        virtual bool IsValid() const override { return true; }
+        
+        FIntTagValue Value;
+    };
+    
+    /** Holders of every built-in type, repeated */
+    TArray<TSharedPtr<ITagValueHolder>> MakeMixedHolders(int32 NumHolders)
+    {
+        TArray<TSharedPtr<ITagValueHolder>> Holders;
+        Holders.Reserve(NumHolders);
+        for (int32 Index = 0; Index < NumHolders; ++Index)
+        {
+            switch (Index % 7)
+            {
+            case 0: Holders.Add(MakeShared<TTagValueHolder<FBoolTagValue>>(FBoolTagValue(true))); break;
+            case 1: Holders.Add(MakeShared<TTagValueHolder<FIntTagValue>>(FIntTagValue(1))); break;
+            case 2: Holders.Add(MakeShared<TTagValueHolder<FFloatTagValue>>(FFloatTagValue(1.0f))); break;
+            case 3: Holders.Add(MakeShared<TTagValueHolder<FStringTagValue>>(FStringTagValue(TEXT("Value")))); break;
+            case 4: Holders.Add(MakeShared<TTagValueHolder<FTransformTagValue>>(FTransformTagValue(FTransform::Identity))); break;
+            case 5: Holders.Add(MakeShared<TTagValueHolder<FClassTagValue>>(FClassTagValue(TSoftClassPtr<UObject>()))); break;
+            default: Holders.Add(MakeShared<TTagValueHolder<FObjectTagValue>>(FObjectTagValue(TSoftObjectPtr<UObject>()))); break;
+            }
+        }
+        return Holders;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTagValueTypeIdDefaultTest, "GamplayTagValue.TypeId.NameOnlyHolder",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FTagValueTypeIdDefaultTest::RunTest(const FString& Parameters)
+{
+    const TSharedPtr<ITagValueHolder> Holder = MakeShared<TagValueTypeIdTests::FNameOnlyIntHolder>(42);
+    TestTrue(TEXT("Type id is derived from the type name"), Holder->GetValueTypeId() == ETagValueType::Int);
+    
+    int32 Value = 0;
+    TestTrue(TEXT("Variant reads the holder"), FTagValueVariant::FromHolder(Holder).TryGet(Value) && Value == 42);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTagValueTypeIdForeignStructTest, "GamplayTagValue.TypeId.ForeignStructHolder",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FTagValueTypeIdForeignStructTest::RunTest(const FString& Parameters)
+{
+    // FVector declares no StaticTypeId, so the holder falls back to the name mapping, which does not know it
+    static_assert(TTagValueHolder<FVector>::StaticTypeId == ETagValueType::None, "Structs without a type id map to None");
+    static_assert(TTagValueHolder<FIntTagValue>::StaticTypeId == ETagValueType::Int, "Built-in value structs keep their type id");
+    
+    const TSharedPtr<ITagValueHolder> Holder = MakeShared<TTagValueHolder<FVector>>(FVector(1.0, 2.0, 3.0));
+    TestTrue(TEXT("Type id of an unknown struct is None"), Holder->GetValueTypeId() == ETagValueType::None);
+    TestFalse(TEXT("Variant does not claim to hold the unknown struct"), FTagValueVariant::FromHolder(Holder).IsSet());
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTagValueTypeIdBenchmark, "GamplayTagValue.Performance.TypeIdDispatch",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FTagValueTypeIdBenchmark::RunTest(const FString& Parameters)
+{
+    constexpr int32 NumHolders = 7 * 1024;
+    constexpr int32 NumDispatches = 4 * 1024 * 1024;
+    const TArray<TSharedPtr<ITagValueHolder>> Holders = TagValueTypeIdTests::MakeMixedHolders(NumHolders);
+    
+    // The name chain mirrors the dispatch that type ids replaced
+    int64 NameSum = 0;
+    const double NameNanoseconds = TagValueBenchmark::TimeNanosecondsPerCall(NumDispatches, [&](int32 Dispatch)
+    {
+        const FName TypeName = Holders[Dispatch % NumHolders]->GetValueTypeName();
+        if (TypeName == FBoolTagValue::StaticStruct()->GetFName()) { NameSum += 1; }
+        else if (TypeName == FIntTagValue::StaticStruct()->GetFName()) { NameSum += 2; }
+        else if (TypeName == FFloatTagValue::StaticStruct()->GetFName()) { NameSum += 3; }
+        else if (TypeName == FStringTagValue::StaticStruct()->GetFName()) { NameSum += 4; }
+        else if (TypeName == FTransformTagValue::StaticStruct()->GetFName()) { NameSum += 5; }
+        else if (TypeName == FClassTagValue::StaticStruct()->GetFName()) { NameSum += 6; }
+        else if (TypeName == FObjectTagValue::StaticStruct()->GetFName()) { NameSum += 7; }
+    });
+    
+    int64 IdSum = 0;
+    const double IdNanoseconds = TagValueBenchmark::TimeNanosecondsPerCall(NumDispatches, [&](int32 Dispatch)
+    {
+        switch (Holders[Dispatch % NumHolders]->GetValueTypeId())
+        {
+        case ETagValueType::Bool: IdSum += 1; break;
+        case ETagValueType::Int: IdSum += 2; break;
+        case ETagValueType::Float: IdSum += 3; break;
+        case ETagValueType::String: IdSum += 4; break;
+        case ETagValueType::Transform: IdSum += 5; break;
+        case ETagValueType::Class: IdSum += 6; break;
+        case ETagValueType::Object: IdSum += 7; break;
+        default: break;
+        }
+    });
+    
+    TestEqual(TEXT("Both dispatches classify every holder the same way"), IdSum, NameSum);
+    AddInfo(FString::Printf(TEXT("Name compare chain: %.2f ns per dispatch"), NameNanoseconds));
+    AddInfo(FString::Printf(TEXT("Type id switch: %.2f ns per dispatch"), IdNanoseconds));
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
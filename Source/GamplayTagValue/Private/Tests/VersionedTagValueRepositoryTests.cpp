@@ -0,0 +1,110 @@
+// Copyright 2025 Nguyen Phi Hung. All Rights Reserved.
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "TagValueTestHelpers.h"
+#include "VersionedTagValueRepository.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVersionedTagValueRepositoryTypedReadTest, "GamplayTagValue.VersionedRepository.TypedRead",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVersionedTagValueRepositoryTypedReadTest::RunTest(const FString& Parameters)
+{
+    const TArray<FGameplayTag> Leaves = TagValueTestTags::GetLeafTags();
+    FVersionedTagValueRepository Repository(TEXT("Versioned"), 0);
+    Repository.SetValue(Leaves[0], MakeShared<TTagValueHolder<FIntTagValue>>(FIntTagValue(7)));
+    Repository.SetValue(Leaves[1], MakeShared<TTagValueHolder<FTransformTagValue>>(FTransformTagValue(TagValueStress::MakeUniformTransform(3))));
+    Repository.SetValue(Leaves[2], MakeShared<TTagValueHolder<FStringTagValue>>(FStringTagValue(TEXT("Value"))));
+    
+    int32 IntValue = 0;
+    FTransform Transform;
+    FString String;
+    float FloatValue = 0.0f;
+    TestTrue(TEXT("Int is read from the slot word"), Repository.TryGetTypedValue(Leaves[0], IntValue) && IntValue == 7);
+    TestTrue(TEXT("Transform is read from the slot storage"), Repository.TryGetTypedValue(Leaves[1], Transform) && Transform.GetTranslation().X == 3.0);
+    TestTrue(TEXT("String is read from the slot holder"), Repository.TryGetTypedValue(Leaves[2], String) && String == TEXT("Value"));
+    TestFalse(TEXT("Reading as another type fails"), Repository.TryGetTypedValue(Leaves[0], FloatValue));
+    TestFalse(TEXT("Tag without a value finds nothing"), Repository.TryGetTypedValue(Leaves[3], IntValue));
+    
+    // Replacing a boxed value with an inline one releases the holder and changes the type readers see
+    Repository.SetValue(Leaves[2], MakeShared<TTagValueHolder<FIntTagValue>>(FIntTagValue(9)));
+    TestFalse(TEXT("Replaced string is gone"), Repository.TryGetTypedValue(Leaves[2], String));
+    TestTrue(TEXT("Replacement is read"), Repository.TryGetTypedValue(Leaves[2], IntValue) && IntValue == 9);
+    
+    Repository.RemoveValue(Leaves[0]);
+    TestFalse(TEXT("Removed value is gone"), Repository.HasValue(Leaves[0]));
+    TestEqual(TEXT("Remaining tags are listed"), Repository.GetAllTags().Num(), 2);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVersionedTagValueRepositoryTornValueTest, "GamplayTagValue.VersionedRepository.TornValues",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVersionedTagValueRepositoryTornValueTest::RunTest(const FString& Parameters)
+{
+    constexpr int32 NumReaders = 4;
+    constexpr int32 NumWrites = 20000;
+    
+    const TArray<FGameplayTag> Leaves = TagValueTestTags::GetLeafTags();
+    FVersionedTagValueRepository Repository(TEXT("Versioned"), 0);
+    Repository.SetValue(Leaves[0], MakeShared<TTagValueHolder<FTransformTagValue>>(FTransformTagValue(TagValueStress::MakeUniformTransform(0))));
+    Repository.SetValue(Leaves[1], MakeShared<TTagValueHolder<FStringTagValue>>(FStringTagValue(TagValueStress::MakeUniformString(0))));
+    Repository.SetValue(Leaves[2], MakeShared<TTagValueHolder<FStringTagValue>>(FStringTagValue(TagValueStress::MakeUniformString(0))));
+    
+    std::atomic<int32> NumTorn = 0;
+    std::atomic<int32> NumMissing = 0;
+    std::atomic<int64> NumReads = 0;
+    TagValueStress::RunWriterWithReaders(NumReaders, [&]()
+    {
+        // Every string write retires a holder, and the third tag flips between a string and an int,
+        // so readers keep racing the reclamation of holders they may have just loaded
+        for (int32 Write = 1; Write <= NumWrites; ++Write)
+        {
+            Repository.SetValue(Leaves[0], MakeShared<TTagValueHolder<FTransformTagValue>>(FTransformTagValue(TagValueStress::MakeUniformTransform(Write))));
+            Repository.SetValue(Leaves[1], MakeShared<TTagValueHolder<FStringTagValue>>(FStringTagValue(TagValueStress::MakeUniformString(Write))));
+            if (Write & 1)
+            {
+                Repository.SetValue(Leaves[2], MakeShared<TTagValueHolder<FIntTagValue>>(FIntTagValue(Write)));
+            }
+            else
+            {
+                Repository.SetValue(Leaves[2], MakeShared<TTagValueHolder<FStringTagValue>>(FStringTagValue(TagValueStress::MakeUniformString(Write))));
+            }
+        }
+    },
+    [&](int32 ReaderIndex)
+    {
+        FTransform Transform;
+        FString String;
+        FTagValueVariant Untyped;
+        FString FlippingString;
+        if (!Repository.TryGetTypedValue(Leaves[0], Transform) || !Repository.TryGetTypedValue(Leaves[1], String) || !Repository.TryGetRaw(Leaves[1], Untyped))
+        {
+            NumMissing.fetch_add(1, std::memory_order_relaxed);
+        }
+        else if (!TagValueStress::IsUniformTransform(Transform) || !TagValueStress::IsUniformString(String)
+            || !Untyped.TryGet(String) || !TagValueStress::IsUniformString(String))
+        {
+            NumTorn.fetch_add(1, std::memory_order_relaxed);
+        }
+        
+        // The flipping tag always holds a string or an int, and a string read from it must be whole
+        if (!Repository.HasValue(Leaves[2]))
+        {
+            NumMissing.fetch_add(1, std::memory_order_relaxed);
+        }
+        else if (Repository.TryGetTypedValue(Leaves[2], FlippingString) && !TagValueStress::IsUniformString(FlippingString))
+        {
+            NumTorn.fetch_add(1, std::memory_order_relaxed);
+        }
+        NumReads.fetch_add(1, std::memory_order_relaxed);
+    });
+    
+    TestEqual(TEXT("No read saw a torn value"), NumTorn.load(), 0);
+    TestEqual(TEXT("No read missed a value"), NumMissing.load(), 0);
+    AddInfo(FString::Printf(TEXT("%lld reads raced %d writes"), NumReads.load(), NumWrites));
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,350 @@
+// Copyright 2025 Nguyen Phi Hung. All Rights Reserved.
+#include "VersionedTagValueRepository.h"
+#include "GameplayTagsManager.h"
+#include "GameplayTagsModule.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/ScopeLock.h"
+#include "TagValueTagIndex.h"
+
+FVersionedTagValueRepository::FSlotTable::FSlotTable()
+    : Num(FTagValueTagIndex::GetNumIndices())
+    , Slots(MakeUnique<FSlot[]>(Num))
+{
+    BoxedOwners.SetNum(Num);
+    
+    // Tables are built on the game thread, so the tag manager is only consulted here and never by readers
+    const UGameplayTagsManager& Manager = UGameplayTagsManager::Get();
+    SlotTags.SetNum(Num);
+    SlotIndices.Reserve(Num);
+    for (int32 Index = 0; Index < Num; ++Index)
+    {
+        SlotTags[Index] = Manager.GetTagFromNetIndex(static_cast<FGameplayTagNetIndex>(Index));
+        if (SlotTags[Index].IsValid())
+        {
+            SlotIndices.Add(SlotTags[Index], Index);
+        }
+    }
+}
+
+FVersionedTagValueRepository::FSlotTable::~FSlotTable()
+{
+    for (int32 Index = 0; Index < Num; ++Index)
+    {
+        delete Slots[Index].Transform.load(std::memory_order_relaxed);
+    }
+}
+
+FVersionedTagValueRepository::FVersionedTagValueRepository(const FName& InName, int32 InPriority)
+    : Table(new FSlotTable())
+    , RepositoryName(InName)
+    , Priority(InPriority)
+{
+    TagTreeChangedHandle = IGameplayTagsModule::OnGameplayTagTreeChanged.AddRaw(this, &FVersionedTagValueRepository::Reindex);
+    EndFrameHandle = FCoreDelegates::OnEndFrame.AddRaw(this, &FVersionedTagValueRepository::HandleEndFrame);
+}
+
+FVersionedTagValueRepository::~FVersionedTagValueRepository()
+{
+    IGameplayTagsModule::OnGameplayTagTreeChanged.Remove(TagTreeChangedHandle);
+    FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+    
+    // The owner guarantees no reader outlives the repository
+    delete Table.load(std::memory_order_relaxed);
+}
+
+int32 FVersionedTagValueRepository::FindSlotIndex(const FSlotTable& InTable, const FGameplayTag& Tag)
+{
+    // Resolved against the table's own map rather than the live tree, which may already have changed
+    const int32* Index = InTable.SlotIndices.Find(Tag);
+    return Index ? *Index : INDEX_NONE;
+}
+
+const FVersionedTagValueRepository::FSlot* FVersionedTagValueRepository::FindSlot(const FGameplayTag& Tag) const
+{
+    const FSlotTable* CurrentTable = Table.load(std::memory_order_acquire);
+    const int32 Index = FindSlotIndex(*CurrentTable, Tag);
+    return Index != INDEX_NONE ? &CurrentTable->Slots[Index] : nullptr;
+}
+
+bool FVersionedTagValueRepository::ReadSlot(const FSlot& Slot, FTagValueVariant& OutValue)
+{
+    // Small values and the type are read together with a single load
+    const uint64 Word = Slot.Word.load(std::memory_order_acquire);
+    const uint32 Bits = static_cast<uint32>(Word);
+    
+    switch (GetWordType(Word))
+    {
+    case ETagValueType::Bool:
+        OutValue.SetBool(Bits != 0);
+        return true;
+    case ETagValueType::Int:
+        OutValue.SetInt(static_cast<int32>(Bits));
+        return true;
+    case ETagValueType::Float:
+        {
+            float Value;
+            FMemory::Memcpy(&Value, &Bits, sizeof(Value));
+            OutValue.SetFloat(Value);
+            return true;
+        }
+    case ETagValueType::Transform:
+        {
+            FTransform Value;
+            ReadTransform(Slot, Value);
+            OutValue = FTagValueVariant::FromHolder(MakeShared<TTagValueHolder<FTransformTagValue>>(FTransformTagValue(Value)));
+            return true;
+        }
+    case ETagValueType::None:
+        OutValue.Reset();
+        return false;
+    default:
+        {
+            // Holders are immutable and swapped whole; a replaced one stays alive while the caller's reader scope is open.
+            // The copy keeps callers from holding on to repository memory.
+            const ITagValueHolder* Holder = Slot.Boxed.load(std::memory_order_acquire);
+            OutValue = Holder ? FTagValueVariant::FromHolder(Holder->Clone()) : FTagValueVariant();
+            return OutValue.IsSet();
+        }
+    }
+}
+
+void FVersionedTagValueRepository::ReadTransform(const FSlot& Slot, FTransform& OutValue)
+{
+    // Seqlock read: copy, then retry if a writer started or finished meanwhile.
+    // A copy that raced a writer may be torn, but it is overwritten by the retry.
+    const FTransform* Storage = Slot.Transform.load(std::memory_order_acquire);
+    for (;;)
+    {
+        const uint32 Sequence = Slot.Sequence.load(std::memory_order_acquire);
+        if (Sequence & 1)
+        {
+            FPlatformProcess::YieldThread();
+            continue;
+        }
+        
+        OutValue = *Storage;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (Slot.Sequence.load(std::memory_order_relaxed) == Sequence)
+        {
+            return;
+        }
+    }
+}
+
+bool FVersionedTagValueRepository::HasValue(FGameplayTag Tag) const
+{
+    const FTagValueReaderEpoch::FReadScope ReadScope(ReaderEpoch);
+    const FSlot* Slot = FindSlot(Tag);
+    return Slot && Slot->Word.load(std::memory_order_acquire) != 0;
+}
+
+TSharedPtr<ITagValueHolder> FVersionedTagValueRepository::GetValue(FGameplayTag Tag) const
+{
+    FTagValueVariant Value;
+    return TryGetRaw(Tag, Value) ? Value.ToHolder() : nullptr;
+}
+
+bool FVersionedTagValueRepository::TryGetRaw(FGameplayTag Tag, FTagValueVariant& OutValue) const
+{
+    const FTagValueReaderEpoch::FReadScope ReadScope(ReaderEpoch);
+    const FSlot* Slot = FindSlot(Tag);
+    if (!Slot)
+    {
+        OutValue.Reset();
+        return false;
+    }
+    return ReadSlot(*Slot, OutValue);
+}
+
+void FVersionedTagValueRepository::WriteSlot(FSlotTable& InTable, int32 Index, const TSharedPtr<ITagValueHolder>& Value)
+{
+    FSlot& Slot = InTable.Slots[Index];
+    const ETagValueType Type = Value->GetValueTypeId();
+    void* ValuePtr = Value->GetValuePtr();
+    
+    uint32 Bits = 0;
+    bool bBoxed = false;
+    switch (Type)
+    {
+    case ETagValueType::Bool:
+        Bits = static_cast<FBoolTagValue*>(ValuePtr)->Value ? 1 : 0;
+        break;
+    case ETagValueType::Int:
+        Bits = static_cast<uint32>(static_cast<FIntTagValue*>(ValuePtr)->Value);
+        break;
+    case ETagValueType::Float:
+        FMemory::Memcpy(&Bits, &static_cast<FFloatTagValue*>(ValuePtr)->Value, sizeof(Bits));
+        break;
+    case ETagValueType::Transform:
+        {
+            FTransform* Storage = Slot.Transform.load(std::memory_order_relaxed);
+            if (!Storage)
+            {
+                Storage = new FTransform();
+                Slot.Transform.store(Storage, std::memory_order_release);
+            }
+            
+            // Odd sequence while writing, so readers that overlap the write retry
+            const uint32 Sequence = Slot.Sequence.load(std::memory_order_relaxed);
+            Slot.Sequence.store(Sequence + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            *Storage = static_cast<FTransformTagValue*>(ValuePtr)->Value;
+            Slot.Sequence.store(Sequence + 2, std::memory_order_release);
+            break;
+        }
+    case ETagValueType::String:
+    case ETagValueType::Class:
+    case ETagValueType::Object:
+        {
+            // The caller keeps its holder and may modify it later, so publish a private copy
+            TSharedPtr<ITagValueHolder> Holder = Value->Clone();
+            Slot.Boxed.store(Holder.Get(), std::memory_order_release);
+            RetireHolder(MoveTemp(InTable.BoxedOwners[Index]));
+            InTable.BoxedOwners[Index] = MoveTemp(Holder);
+            bBoxed = true;
+            break;
+        }
+    default:
+        return;
+    }
+    
+    // Publish the type after the payload
+    Slot.Word.store(MakeWord(Type, Bits), std::memory_order_release);
+    
+    // A replaced out-of-line value is released once no reader can still be looking at it
+    if (!bBoxed && InTable.BoxedOwners[Index].IsValid())
+    {
+        Slot.Boxed.store(nullptr, std::memory_order_release);
+        RetireHolder(MoveTemp(InTable.BoxedOwners[Index]));
+    }
+}
+
+void FVersionedTagValueRepository::ClearSlot(FSlotTable& InTable, int32 Index)
+{
+    FSlot& Slot = InTable.Slots[Index];
+    Slot.Word.store(0, std::memory_order_release);
+    
+    if (InTable.BoxedOwners[Index].IsValid())
+    {
+        Slot.Boxed.store(nullptr, std::memory_order_release);
+        RetireHolder(MoveTemp(InTable.BoxedOwners[Index]));
+    }
+}
+
+void FVersionedTagValueRepository::RetireHolder(TSharedPtr<ITagValueHolder>&& Holder)
+{
+    if (Holder.IsValid())
+    {
+        ReaderEpoch.Retire(MoveTemp(Holder));
+    }
+}
+
+void FVersionedTagValueRepository::SetValue(FGameplayTag Tag, TSharedPtr<ITagValueHolder> Value)
+{
+    if (!Tag.IsValid() || !Value.IsValid() || !Value->IsValid())
+    {
+        return;
+    }
+    
+    FScopeLock Lock(&WriterLock);
+    
+    FSlotTable& CurrentTable = *Table.load(std::memory_order_relaxed);
+    const int32 Index = FindSlotIndex(CurrentTable, Tag);
+    if (Index == INDEX_NONE)
+    {
+        return;
+    }
+    
+    WriteSlot(CurrentTable, Index, Value);
+    BumpGeneration();
+    ReaderEpoch.Reclaim();
+}
+
+void FVersionedTagValueRepository::RemoveValue(FGameplayTag Tag)
+{
+    FScopeLock Lock(&WriterLock);
+    
+    FSlotTable& CurrentTable = *Table.load(std::memory_order_relaxed);
+    const int32 Index = FindSlotIndex(CurrentTable, Tag);
+    if (Index == INDEX_NONE || CurrentTable.Slots[Index].Word.load(std::memory_order_relaxed) == 0)
+    {
+        return;
+    }
+    
+    ClearSlot(CurrentTable, Index);
+    BumpGeneration();
+    ReaderEpoch.Reclaim();
+}
+
+void FVersionedTagValueRepository::ClearAllValues()
+{
+    FScopeLock Lock(&WriterLock);
+    
+    FSlotTable& CurrentTable = *Table.load(std::memory_order_relaxed);
+    for (int32 Index = 0; Index < CurrentTable.Num; ++Index)
+    {
+        if (CurrentTable.Slots[Index].Word.load(std::memory_order_relaxed) != 0)
+        {
+            ClearSlot(CurrentTable, Index);
+        }
+    }
+    BumpGeneration();
+    ReaderEpoch.Reclaim();
+}
+
+TArray<FGameplayTag> FVersionedTagValueRepository::GetAllTags() const
+{
+    FScopeLock Lock(&WriterLock);
+    
+    TArray<FGameplayTag> Result;
+    const FSlotTable& CurrentTable = *Table.load(std::memory_order_relaxed);
+    for (int32 Index = 0; Index < CurrentTable.Num; ++Index)
+    {
+        if (CurrentTable.Slots[Index].Word.load(std::memory_order_relaxed) != 0)
+        {
+            Result.Add(CurrentTable.SlotTags[Index]);
+        }
+    }
+    return Result;
+}
+
+void FVersionedTagValueRepository::Reindex()
+{
+    FScopeLock Lock(&WriterLock);
+    
+    FSlotTable* OldTable = Table.load(std::memory_order_relaxed);
+    FSlotTable* NewTable = new FSlotTable();
+    
+    for (int32 OldIndex = 0; OldIndex < OldTable->Num; ++OldIndex)
+    {
+        // Tags that were removed from the tree are dropped here
+        FTagValueVariant Value;
+        const int32 NewIndex = FindSlotIndex(*NewTable, OldTable->SlotTags[OldIndex]);
+        if (NewIndex != INDEX_NONE && ReadSlot(OldTable->Slots[OldIndex], Value))
+        {
+            WriteSlot(*NewTable, NewIndex, Value.ToHolder());
+        }
+    }
+    
+    // Readers may still be using the old table, so it is retired rather than deleted
+    Table.store(NewTable, std::memory_order_release);
+    ReaderEpoch.Retire(TUniquePtr<FSlotTable>(OldTable));
+    BumpGeneration();
+    ReaderEpoch.Reclaim();
+}
+
+void FVersionedTagValueRepository::HandleEndFrame()
+{
+    FScopeLock Lock(&WriterLock);
+    ReaderEpoch.Reclaim();
+}
+
+FName FVersionedTagValueRepository::GetRepositoryName() const
+{
+    return RepositoryName;
+}
+
+int32 FVersionedTagValueRepository::GetPriority() const
+{
+    return Priority;
+}
@@ -0,0 +1,161 @@
+// Copyright 2025 Nguyen Phi Hung. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTags.h"
+#include "TagValueInterface.h"
+#include "TagValueTypes.h"
+
+/**
+ * Memory-based repository that stores values in per-type columns
+ * Bools live in a bitset, other types in contiguous typed arrays, and a compact
+ * tag -> (type, slot) index sits on top. Values are stored without per-value heap
+ * holders, and TryGetTypedValue reads any type straight from the columns without allocating.
+ * TryGetRaw returns bool, int and float values inline; larger values are copied from their
+ * column into a new holder, since the variant keeps them out of line.
+ * The ITagValueHolder interface is still supported; GetValue() creates a holder on demand.
+ */
+class GAMPLAYTAGVALUE_API FColumnarTagValueRepository : public ITagValueRepository
+{
+public:
+    FColumnarTagValueRepository(const FName& InName, int32 InPriority);
+    
+    // ITagValueRepository interface
+    virtual bool HasValue(FGameplayTag Tag) const override;
+    virtual TSharedPtr<ITagValueHolder> GetValue(FGameplayTag Tag) const override;
+    virtual bool TryGetRaw(FGameplayTag Tag, FTagValueVariant& OutValue) const override;
+    virtual void SetValue(FGameplayTag Tag, TSharedPtr<ITagValueHolder> Value) override;
+    virtual void RemoveValue(FGameplayTag Tag) override;
+    virtual void ClearAllValues() override;
+    virtual TArray<FGameplayTag> GetAllTags() const override;
+    virtual FName GetRepositoryName() const override;
+    virtual int32 GetPriority() const override;
+    
+    /**
+     * Read a typed value without allocating
+     * @param Tag The tag to read
+     * @param OutValue Receives the value if found
+     * @return True if a value of type T is stored for the tag
+     */
+    template<typename T>
+    bool TryGetTypedValue(FGameplayTag Tag, T& OutValue) const
+    {
+        const FValueSlot* Slot = Index.Find(Tag);
+        if (!Slot || Slot->Type != TTagValueTraits<T>::Type)
+        {
+            return false;
+        }
+        
+        if constexpr (std::is_same_v<T, bool>)
+        {
+            OutValue = Bools[Slot->Slot];
+        }
+        else
+        {
+            OutValue = GetColumn<T>()[Slot->Slot];
+        }
+        return true;
+    }
+    
+    /**
+     * Write a typed value, replacing any existing value for the tag
+     * @param Tag The tag to write
+     * @param Value The value to store
+     */
+    template<typename T>
+    void SetTypedValue(FGameplayTag Tag, const T& Value)
+    {
+        if (!Tag.IsValid())
+        {
+            return;
+        }
+        
+        constexpr ETagValueType Type = TTagValueTraits<T>::Type;
+        
+        FValueSlot* Slot = Index.Find(Tag);
+        if (Slot && Slot->Type != Type)
+        {
+            RemoveValue(Tag);
+            Slot = nullptr;
+        }
+        
+        if (Slot)
+        {
+            if constexpr (std::is_same_v<T, bool>)
+            {
+                Bools[Slot->Slot] = Value;
+            }
+            else
+            {
+                GetColumn<T>()[Slot->Slot] = Value;
+            }
+        }
+        else
+        {
+            int32 NewSlot;
+            if constexpr (std::is_same_v<T, bool>)
+            {
+                NewSlot = Bools.Add(Value);
+            }
+            else
+            {
+                NewSlot = GetColumn<T>().Add(Value);
+            }
+            ColumnTags[static_cast<int32>(Type)].Add(Tag);
+            Index.Add(Tag, FValueSlot{ Type, NewSlot });
+            MarkTagPresent(Tag);
+        }
+        
+        BumpGeneration();
+    }
+    
+private:
+    /** Location of a value inside the columns */
+    struct FValueSlot
+    {
+        ETagValueType Type;
+        int32 Slot;
+    };
+    
+    template<typename T>
+    TArray<T>& GetColumn()
+    {
+        return const_cast<TArray<T>&>(static_cast<const FColumnarTagValueRepository*>(this)->GetColumn<T>());
+    }
+    
+    template<typename T>
+    const TArray<T>& GetColumn() const
+    {
+        if constexpr (std::is_same_v<T, int32>) { return Ints; }
+        else if constexpr (std::is_same_v<T, float>) { return Floats; }
+        else if constexpr (std::is_same_v<T, FString>) { return Strings; }
+        else if constexpr (std::is_same_v<T, FTransform>) { return Transforms; }
+        else if constexpr (std::is_same_v<T, TSoftClassPtr<UObject>>) { return Classes; }
+        else { static_assert(std::is_same_v<T, TSoftObjectPtr<UObject>>, "Unsupported tag value type"); return Objects; }
+    }
+    
+    /** Remove the value at a column slot, keeping the column dense */
+    void RemoveFromColumn(ETagValueType Type, int32 Slot);
+    
+    /** Tag -> (type, slot) index */
+    TMap<FGameplayTag, FValueSlot> Index;
+    
+    /** Owning tag of every column slot, used to patch the index when slots move */
+    TArray<FGameplayTag> ColumnTags[static_cast<int32>(ETagValueType::Object) + 1];
+    
+    /** Value columns */
+    TBitArray<> Bools;
+    TArray<int32> Ints;
+    TArray<float> Floats;
+    TArray<FString> Strings;
+    TArray<FTransform> Transforms;
+    TArray<TSoftClassPtr<UObject>> Classes;
+    TArray<TSoftObjectPtr<UObject>> Objects;
+    
+    /** Name of this repository */
+    FName RepositoryName;
+    
+    /** Priority of this repository */
+    int32 Priority;
+};
@@ -3,13 +3,22 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Containers/Queue.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "GameplayTags.h"
 #include "TagValueInterface.h"
 #include "TagValueBase.h"
 #include "TagValueContainer.h"
+#include "TagValueTypes.h"
+#include "TagValueVariant.h"
+#include "TagValueSubscription.h"
+#include "TagValueTagIndex.h"
+#include "TagValueReaderEpoch.h"
+#include <atomic>
 #include "GameplayTagValueSubsystem.generated.h"
 
+struct FTagValueHandleBinding;
+
 /**
  * Delegate for when a tag value changes
  * @param Tag The tag that changed
@@ -17,8 +26,27 @@
  */
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnTagValueChanged, FGameplayTag, Tag, FName, RepositoryName);
 
+/**
+ * Delegate for when a write batch has been committed
+ * @param ChangedTags Every tag that was set, removed, or cleared inside the batch
+ */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnTagValuesBatchChanged, const FGameplayTagContainer&, ChangedTags);
+
+/**
+ * Delegate for when every value of a repository has been cleared
+ * @param RepositoryName The repository that was cleared
+ */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnTagValueRepositoryCleared, FName, RepositoryName);
+
+/**
+ * Native delegate for when every value of a repository has been cleared
+ * @param RepositoryName The repository that was cleared
+ */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnTagValueRepositoryClearedNative, FName /*RepositoryName*/);
+
 /**
  * Memory-based repository implementation for storing tag values in memory
+ * Clearing is O(1): the value map is moved aside and freed by the next write, or handed over whole by DetachAllValues.
  */
 class GAMPLAYTAGVALUE_API FMemoryTagValueRepository : public ITagValueRepository
 {
@@ -28,17 +56,25 @@ public:
     // ITagValueRepository interface
     virtual bool HasValue(FGameplayTag Tag) const override;
     virtual TSharedPtr<ITagValueHolder> GetValue(FGameplayTag Tag) const override;
+    virtual bool TryGetRaw(FGameplayTag Tag, FTagValueVariant& OutValue) const override;
     virtual void SetValue(FGameplayTag Tag, TSharedPtr<ITagValueHolder> Value) override;
     virtual void RemoveValue(FGameplayTag Tag) override;
     virtual void ClearAllValues() override;
+    virtual TSharedPtr<ITagValueRepository> DetachAllValues() override;
     virtual TArray<FGameplayTag> GetAllTags() const override;
     virtual FName GetRepositoryName() const override;
     virtual int32 GetPriority() const override;
-    
+
 private:
+    /** Free the values dropped by the last clear */
+    void ReleaseClearedValues();
+    
     /** Map of tags to their values */
     TMap<FGameplayTag, TSharedPtr<ITagValueHolder>> TagValues;
     
+    /** Values dropped by the last clear, kept until the next write so the clear does not pay for freeing them */
+    TMap<FGameplayTag, TSharedPtr<ITagValueHolder>> ClearedValues;
+    
     /** Name of this repository */
     FName RepositoryName;
     
@@ -55,25 +91,73 @@ UCLASS()
 class GAMPLAYTAGVALUE_API UGameplayTagValueSubsystem : public UGameInstanceSubsystem
 {
     GENERATED_BODY()
-    
+
 public:
     // USubsystem interface
     virtual void Initialize(FSubsystemCollectionBase& Collection) override;
     virtual void Deinitialize() override;
     
     /**
-     * Event triggered when a tag value changes (set, removed, or cleared)
+     * Event triggered when a tag value changes (set or removed); clearing a repository triggers OnRepositoryCleared
      * Provides the tag that changed and the repository name where the change occurred
+     * Changes made inside a write batch are reported when the batch is committed, once per tag and repository,
+     * followed by a single OnTagValuesBatchChanged
+     * Every listener receives every change; prefer SubscribeToTag to listen to specific tags
      */
     UPROPERTY(BlueprintAssignable, Category = "Gameplay Tags|Values")
     FOnTagValueChanged OnTagValueChanged;
     
+    /**
+     * Event triggered once when a write batch is committed, after OnTagValueChanged fired for each change
+     * Provides every tag that changed inside the batch
+     */
+    UPROPERTY(BlueprintAssignable, Category = "Gameplay Tags|Values")
+    FOnTagValuesBatchChanged OnTagValuesBatchChanged;
+    
+    /**
+     * Event triggered once when ClearAllValues empties a repository, delivered like any other change
+     * OnTagValueChanged does not report the individual tags; listeners should treat every tag of the repository as removed.
+     * Tag subscribers do receive a removal for each subscribed tag the repository held.
+     */
+    UPROPERTY(BlueprintAssignable, Category = "Gameplay Tags|Values")
+    FOnTagValueRepositoryCleared OnRepositoryCleared;
+    
+    /** Native event triggered once when ClearAllValues empties a repository, after its tag subscribers were told */
+    FOnTagValueRepositoryClearedNative OnRepositoryClearedNative;
+    
+    /**
+     * Native event triggered for every tag value change, with views of the old and new values
+     * Changes made inside a write batch are delivered on commit, once per tag and repository.
+     * Clearing a repository is reported once through OnRepositoryClearedNative instead of per tag.
+     */
+    FOnTagValueChangedNativeEvent OnTagValueChangedNative;
+    
     /**
      * Register a repository with the subsystem
      * @param Repository The repository to register
      */
     void RegisterRepository(TSharedPtr<ITagValueRepository> Repository);
     
+    /**
+     * Create an in-memory repository and register it with the subsystem
+     * Replaces any existing repository with the same name
+     * @param RepositoryName The name of the repository to create
+     * @param Priority The priority of the repository (higher priority repositories are checked first)
+     * @param Storage The storage backend to use
+     * @return True if the repository was created
+     */
+    UFUNCTION(BlueprintCallable, Category = "Gameplay Tags|Values")
+    bool CreateRepository(FName RepositoryName, int32 Priority, ETagValueRepositoryStorage Storage = ETagValueRepositoryStorage::Map);
+    
+    /**
+     * Create an in-memory repository without registering it
+     * @param RepositoryName The name of the repository to create
+     * @param Priority The priority of the repository (higher priority repositories are checked first)
+     * @param Storage The storage backend to use
+     * @return The new repository
+     */
+    static TSharedPtr<ITagValueRepository> MakeMemoryRepository(FName RepositoryName, int32 Priority, ETagValueRepositoryStorage Storage = ETagValueRepositoryStorage::Map);
+    
     /**
      * Unregister a repository from the subsystem
      * @param RepositoryName The name of the repository to unregister
@@ -89,10 +173,17 @@ public:
     
     /**
      * Get all registered repositories
-     * @return Array of all repositories
+     * @return Array of all repositories, sorted by priority (highest first)
      */
     TArray<TSharedPtr<ITagValueRepository>> GetAllRepositories() const;
     
+    /**
+     * Get all registered repositories without copying or sorting
+     * The pointers are owned by the subsystem and remain valid until the next register/unregister call
+     * @return Non-owning view of the repositories, sorted by priority (highest first)
+     */
+    TArrayView<ITagValueRepository* const> GetSortedRepositories() const { return SortedRepositories; }
+    
     /**
      * Check if a value exists for the given tag in any repository
      * @param Tag The tag to check
@@ -112,6 +203,16 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Gameplay Tags|Values")
     bool GetBoolValue(FGameplayTag Tag, bool DefaultValue = false, UObject* Context = nullptr) const;
     
+    /**
+     * Try to get a bool value for the given tag, resolving the tag only once
+     * @param Tag The tag to get the value for
+     * @param OutValue Receives the value if found; left untouched otherwise
+     * @param Context Optional context object that implements UTagValueInterface
+     * @return True if a bool value was found for the tag
+     */
+    UFUNCTION(BlueprintCallable, Category = "Gameplay Tags|Values")
+    bool TryGetBoolValue(FGameplayTag Tag, bool& OutValue, UObject* Context = nullptr) const;
+    
     /**
      * Set a bool value for the given tag
      * @param Tag The tag to set the value for
@@ -132,6 +233,16 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Gameplay Tags|Values")
     int32 GetIntValue(FGameplayTag Tag, int32 DefaultValue = 0, UObject* Context = nullptr) const;
     
+    /**
+     * Try to get an integer value for the given tag, resolving the tag only once
+     * @param Tag The tag to get the value for
+     * @param OutValue Receives the value if found; left untouched otherwise
+     * @param Context Optional context object that implements UTagValueInterface
+     * @return True if an integer value was found for the tag
+     */
+    UFUNCTION(BlueprintCallable, Category = "Gameplay Tags|Values")
+    bool TryGetIntValue(FGameplayTag Tag, int32& OutValue, UObject* Context = nullptr) const;
+    
     /**
      * Set an integer value for the given tag
      * @param Tag The tag to set the value for
@@ -152,6 +263,16 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Gameplay Tags|Values")
     float GetFloatValue(FGameplayTag Tag, float DefaultValue = 0.0f, UObject* Context = nullptr) const;
     
+    /**
+     * Try to get a float value for the given tag, resolving the tag only once
+     * @param Tag The tag to get the value for
+     * @param OutValue Receives the value if found; left untouched otherwise
+     * @param Context Optional context object that implements UTagValueInterface
+     * @return True if a float value was found for the tag
+     */
+    UFUNCTION(BlueprintCallable, Category = "Gameplay Tags|Values")
+    bool TryGetFloatValue(FGameplayTag Tag, float& OutValue, UObject* Context = nullptr) const;
+    
     /**
      * Set a float value for the given tag
      * @param Tag The tag to set the value for
@@ -172,6 +293,16 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Gameplay Tags|Values")
     FString GetStringValue(FGameplayTag Tag, const FString& DefaultValue = "", UObject* Context = nullptr) const;
     
+    /**
+     * Try to get a string value for the given tag, resolving the tag only once
+     * @param Tag The tag to get the value for
+     * @param OutValue Receives the value if found; left untouched otherwise
+     * @param Context Optional context object that implements UTagValueInterface
+     * @return True if a string value was found for the tag
+     */
+    UFUNCTION(BlueprintCallable, Category = "Gameplay Tags|Values")
+    bool TryGetStringValue(FGameplayTag Tag, FString& OutValue, UObject* Context = nullptr) const;
+    
     /**
      * Set a string value for the given tag
      * @param Tag The tag to set the value for
@@ -192,6 +323,16 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Gameplay Tags|Values")
     FTransform GetTransformValue(FGameplayTag Tag, const FTransform& DefaultValue, UObject* Context = nullptr) const;
     
+    /**
+     * Try to get a transform value for the given tag, resolving the tag only once
+     * @param Tag The tag to get the value for
+     * @param OutValue Receives the value if found; left untouched otherwise
+     * @param Context Optional context object that implements UTagValueInterface
+     * @return True if a transform value was found for the tag
+     */
+    UFUNCTION(BlueprintCallable, Category = "Gameplay Tags|Values")
+    bool TryGetTransformValue(FGameplayTag Tag, FTransform& OutValue, UObject* Context = nullptr) const;
+    
     /**
      * Set a transform value for the given tag
      * @param Tag The tag to set the value for
@@ -212,6 +353,16 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Gameplay Tags|Values")
     TSoftClassPtr<UObject> GetClassValue(FGameplayTag Tag, TSoftClassPtr<UObject> DefaultValue = nullptr, UObject* Context = nullptr) const;
     
+    /**
+     * Try to get a class value for the given tag, resolving the tag only once
+     * @param Tag The tag to get the value for
+     * @param OutValue Receives the value if found; left untouched otherwise
+     * @param Context Optional context object that implements UTagValueInterface
+     * @return True if a class value was found for the tag
+     */
+    UFUNCTION(BlueprintCallable, Category = "Gameplay Tags|Values")
+    bool TryGetClassValue(FGameplayTag Tag, TSoftClassPtr<UObject>& OutValue, UObject* Context = nullptr) const;
+    
     /**
      * Set a class value for the given tag
      * @param Tag The tag to set the value for
@@ -232,6 +383,16 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Gameplay Tags|Values")
     TSoftObjectPtr<UObject> GetObjectValue(FGameplayTag Tag, TSoftObjectPtr<UObject> DefaultValue = nullptr, UObject* Context = nullptr) const;
     
+    /**
+     * Try to get an object value for the given tag, resolving the tag only once
+     * @param Tag The tag to get the value for
+     * @param OutValue Receives the value if found; left untouched otherwise
+     * @param Context Optional context object that implements UTagValueInterface
+     * @return True if an object value was found for the tag
+     */
+    UFUNCTION(BlueprintCallable, Category = "Gameplay Tags|Values")
+    bool TryGetObjectValue(FGameplayTag Tag, TSoftObjectPtr<UObject>& OutValue, UObject* Context = nullptr) const;
+    
     /**
      * Set an object value for the given tag
      * @param Tag The tag to set the value for
@@ -250,6 +411,159 @@ public:
      */
     TSharedPtr<ITagValueHolder> GetRawValue(FGameplayTag Tag, UObject* Context = nullptr) const;
     
+    /**
+     * Get the value for the given tag without going through a shared holder
+     * Bool, int and float values are returned inline without allocating.
+     * Context objects only provide typed values, so they are not consulted here.
+     * @param Tag The tag to get the value for
+     * @param OutValue Receives the resolved value, including values inherited from parent tags
+     * @return True if a value was found
+     */
+    bool TryGetRaw(FGameplayTag Tag, FTagValueVariant& OutValue) const;
+    
+    /**
+     * Get the value for a tag whose dense index is cached, as with TryGetRaw
+     * With the effective value table enabled the read does not go through the tag manager at all.
+     * @param Tag The tag to get the value for, with its cached index
+     * @param OutValue Receives the resolved value, including values inherited from parent tags
+     * @return True if a value was found
+     */
+    bool TryGetRaw(const FTagValueIndexedTag& Tag, FTagValueVariant& OutValue) const;
+    
+    /**
+     * Resolve a tag for a TTagValueHandle and record what the result depends on
+     * @param Tag The tag to resolve
+     * @param OutValue Receives the resolved value, as with TryGetRaw
+     * @param OutBinding Receives the repositories the value depends on
+     * @return True if a value was found
+     */
+    bool BindTagValueHandle(FGameplayTag Tag, FTagValueVariant& OutValue, FTagValueHandleBinding& OutBinding) const;
+    
+    /** Get a counter that is bumped whenever repositories are registered, unregistered or reordered, the tag tree changes, or the subsystem is deinitialized */
+    uint32 GetRepositoryLayoutGeneration() const { return RepositoryLayoutGeneration; }
+    
+    /**
+     * Get the values of many tags in one call
+     * The repositories are flushed for changes once, and tags that share ancestors reuse each other's walk.
+     * Context objects are not consulted, as with TryGetRaw.
+     * @param Tags The tags to get the values for
+     * @param OutValues Receives the value of each tag at the same index; unset if the tag has no value
+     * @return The number of tags a value was found for
+     */
+    int32 GetValuesBatch(TArrayView<const FGameplayTag> Tags, TArrayView<FTagValueVariant> OutValues) const;
+    
+    /**
+     * Get the typed values of many tags in one call
+     * @param Tags The tags to get the values for
+     * @param OutValues Receives the value of each tag at the same index, or DefaultValue if not found
+     * @param DefaultValue The value to write for tags without a value of type T
+     * @return The number of tags a value of type T was found for
+     */
+    template<typename T>
+    int32 GetTypedValuesBatch(TArrayView<const FGameplayTag> Tags, TArrayView<T> OutValues, const T& DefaultValue = T()) const
+    {
+        check(Tags.Num() == OutValues.Num());
+        
+        int32 NumFound = 0;
+        for (int32 Index = 0; Index < Tags.Num(); ++Index)
+        {
+            OutValues[Index] = DefaultValue;
+            if (Tags[Index].IsValid() && ResolveTag(Tags[Index]).Value.TryGet(OutValues[Index]))
+            {
+                ++NumFound;
+            }
+        }
+        return NumFound;
+    }
+    
+    /**
+     * Get the typed values of many tags whose dense indices are cached
+     * @param Tags The tags to get the values for, with their cached indices
+     * @param OutValues Receives the value of each tag at the same index, or DefaultValue if not found
+     * @param DefaultValue The value to write for tags without a value of type T
+     * @return The number of tags a value of type T was found for
+     */
+    template<typename T>
+    int32 GetTypedValuesBatch(TArrayView<const FTagValueIndexedTag> Tags, TArrayView<T> OutValues, const T& DefaultValue = T()) const
+    {
+        check(Tags.Num() == OutValues.Num());
+        
+        int32 NumFound = 0;
+        for (int32 Index = 0; Index < Tags.Num(); ++Index)
+        {
+            const FGameplayTag& Tag = Tags[Index].GetTag();
+            OutValues[Index] = DefaultValue;
+            if (Tag.IsValid() && ResolveTag(Tag, Tags[Index].GetIndex()).Value.TryGet(OutValues[Index]))
+            {
+                ++NumFound;
+            }
+        }
+        return NumFound;
+    }
+    
+    /**
+     * Get the bool values of many tags in one call
+     * @param Tags The tags to get the values for
+     * @param OutValues Receives the bool value of every tag that has one
+     * @return The number of tags a bool value was found for
+     */
+    UFUNCTION(BlueprintCallable, Category = "Gameplay Tags|Values")
+    int32 GetBoolValuesForTags(const FGameplayTagContainer& Tags, TMap<FGameplayTag, bool>& OutValues) const;
+    
+    /**
+     * Get the int values of many tags in one call
+     * @param Tags The tags to get the values for
+     * @param OutValues Receives the int value of every tag that has one
+     * @return The number of tags a int value was found for
+     */
+    UFUNCTION(BlueprintCallable, Category = "Gameplay Tags|Values")
+    int32 GetIntValuesForTags(const FGameplayTagContainer& Tags, TMap<FGameplayTag, int32>& OutValues) const;
+    
+    /**
+     * Get the float values of many tags in one call
+     * @param Tags The tags to get the values for
+     * @param OutValues Receives the float value of every tag that has one
+     * @return The number of tags a float value was found for
+     */
+    UFUNCTION(BlueprintCallable, Category = "Gameplay Tags|Values")
+    int32 GetFloatValuesForTags(const FGameplayTagContainer& Tags, TMap<FGameplayTag, float>& OutValues) const;
+    
+    /**
+     * Get the string values of many tags in one call
+     * @param Tags The tags to get the values for
+     * @param OutValues Receives the string value of every tag that has one
+     * @return The number of tags a string value was found for
+     */
+    UFUNCTION(BlueprintCallable, Category = "Gameplay Tags|Values")
+    int32 GetStringValuesForTags(const FGameplayTagContainer& Tags, TMap<FGameplayTag, FString>& OutValues) const;
+    
+    /**
+     * Get the transform values of many tags in one call
+     * @param Tags The tags to get the values for
+     * @param OutValues Receives the transform value of every tag that has one
+     * @return The number of tags a transform value was found for
+     */
+    UFUNCTION(BlueprintCallable, Category = "Gameplay Tags|Values")
+    int32 GetTransformValuesForTags(const FGameplayTagContainer& Tags, TMap<FGameplayTag, FTransform>& OutValues) const;
+    
+    /**
+     * Get the class values of many tags in one call
+     * @param Tags The tags to get the values for
+     * @param OutValues Receives the class value of every tag that has one
+     * @return The number of tags a class value was found for
+     */
+    UFUNCTION(BlueprintCallable, Category = "Gameplay Tags|Values")
+    int32 GetClassValuesForTags(const FGameplayTagContainer& Tags, TMap<FGameplayTag, TSoftClassPtr<UObject>>& OutValues) const;
+    
+    /**
+     * Get the object values of many tags in one call
+     * @param Tags The tags to get the values for
+     * @param OutValues Receives the object value of every tag that has one
+     * @return The number of tags a object value was found for
+     */
+    UFUNCTION(BlueprintCallable, Category = "Gameplay Tags|Values")
+    int32 GetObjectValuesForTags(const FGameplayTagContainer& Tags, TMap<FGameplayTag, TSoftObjectPtr<UObject>>& OutValues) const;
+    
     /**
      * Set a raw value holder for the given tag
      * @param Tag The tag to set the value for
@@ -261,15 +575,59 @@ public:
     
     /**
      * Remove a value for the given tag
+     * Inside a write batch the removal is staged and applied on commit, in order with the batch's other writes.
      * @param Tag The tag to remove the value for
      * @param RepositoryName Optional repository name to target (removes from all if not specified)
-     * @return True if the value was removed successfully
+     * @return True if the value was removed successfully; inside a batch, true if there is a value to remove
      */
     UFUNCTION(BlueprintCallable, Category = "Gameplay Tags|Values")
     bool RemoveTagValue(FGameplayTag Tag, FName RepositoryName = NAME_None);
     
+    /**
+     * Queue a write from any thread
+     * Queued writes are applied on the game thread at the end of the frame, or by DrainQueuedWrites,
+     * inside a single write batch. Repeated sets, or repeated removals, of the same tag and repository
+     * are coalesced to the last one, so listeners hear about each tag once. A removal is never merged
+     * into a set, so removing a tag from all repositories and then setting it applies both in order.
+     * @param Tag The tag to set the value for
+     * @param Value The value holder to set, or nullptr to remove the value
+     * @param RepositoryName Optional repository name to target, resolved when the write is applied
+     */
+    void EnqueueRawValue(FGameplayTag Tag, TSharedPtr<ITagValueHolder> Value, FName RepositoryName = NAME_None);
+    
+    /**
+     * Queue a typed write from any thread; see EnqueueRawValue
+     * @param Tag The tag to set the value for
+     * @param Value The value to set
+     * @param RepositoryName Optional repository name to target
+     */
+    template<typename T>
+    void EnqueueValue(FGameplayTag Tag, const T& Value, FName RepositoryName = NAME_None)
+    {
+        using TagValueType = typename TTagValueTraits<T>::TagValueType;
+        EnqueueRawValue(Tag, MakeShared<TTagValueHolder<TagValueType>>(TagValueType(Value)), RepositoryName);
+    }
+    
+    /**
+     * Queue the removal of a value from any thread; see EnqueueRawValue
+     * @param Tag The tag to remove the value for
+     * @param RepositoryName Optional repository name to target (removes from all if not specified)
+     */
+    void EnqueueRemoveValue(FGameplayTag Tag, FName RepositoryName = NAME_None)
+    {
+        EnqueueRawValue(Tag, nullptr, RepositoryName);
+    }
+    
+    /** Apply every queued write now, in a single batch; must be called on the game thread */
+    UFUNCTION(BlueprintCallable, Category = "Gameplay Tags|Values")
+    void DrainQueuedWrites();
+    
     /**
      * Clear all values in all repositories or a specific repository
+     * Each cleared repository is announced once through OnRepositoryCleared, not per tag, when changes are delivered:
+     * on commit inside a batch, at the end of the frame in EndOfFrame mode. Tag subscribers still receive a removal
+     * for each subscribed tag, with the old value looked up only then.
+     * Inside a write batch the clear is staged and applied on commit, in order with the batch's other writes.
      * @param RepositoryName Optional repository name to target (clears all if not specified)
      */
     UFUNCTION(BlueprintCallable, Category = "Gameplay Tags|Values")
@@ -308,6 +666,222 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Gameplay Tags|Values")
     int32 RegisterConfiguredDataAssets();
     
+    /**
+     * Subscribe to changes of a tag
+     * Only changes matching the tag and scope are delivered, including changes committed by a write batch
+     * and removals caused by clearing a repository.
+     * @param Tag The tag to subscribe to
+     * @param Scope Whether changes to descendants of the tag are included
+     * @param Delegate The delegate to call on change
+     * @return Handle for UnsubscribeFromTag
+     */
+    FTagValueSubscriptionHandle SubscribeToTag(FGameplayTag Tag, ETagValueSubscriptionScope Scope, FOnTagValueChangedNative Delegate);
+    
+    /**
+     * Subscribe to changes of a tag that leave it with a value of type T
+     * Removals and changes to a value of another type are not delivered.
+     * @param Tag The tag to subscribe to
+     * @param Scope Whether changes to descendants of the tag are included
+     * @param Delegate The delegate to call with the old and new value
+     * @return Handle for UnsubscribeFromTag
+     */
+    template<typename T>
+    FTagValueSubscriptionHandle SubscribeToTypedTag(FGameplayTag Tag, ETagValueSubscriptionScope Scope, TOnTypedTagValueChanged<T> Delegate)
+    {
+        if (!Delegate.IsBound())
+        {
+            return FTagValueSubscriptionHandle();
+        }
+        
+        return SubscribeToTag(Tag, Scope, FOnTagValueChangedNative::CreateLambda([TypedDelegate = MoveTemp(Delegate)](const FTagValueChangeEvent& Event)
+        {
+            T NewValue;
+            if (Event.GetNewValue(NewValue))
+            {
+                T OldValue = T();
+                Event.GetOldValue(OldValue);
+                TypedDelegate.ExecuteIfBound(Event.Tag, OldValue, NewValue);
+            }
+        }));
+    }
+    
+    /** Subscribe to float changes of a tag; see SubscribeToTypedTag */
+    FTagValueSubscriptionHandle OnFloatChanged(FGameplayTag Tag, FOnFloatTagValueChanged Delegate, ETagValueSubscriptionScope Scope = ETagValueSubscriptionScope::ExactTag)
+    {
+        return SubscribeToTypedTag<float>(Tag, Scope, MoveTemp(Delegate));
+    }
+    
+    /** Subscribe to int changes of a tag; see SubscribeToTypedTag */
+    FTagValueSubscriptionHandle OnIntChanged(FGameplayTag Tag, FOnIntTagValueChanged Delegate, ETagValueSubscriptionScope Scope = ETagValueSubscriptionScope::ExactTag)
+    {
+        return SubscribeToTypedTag<int32>(Tag, Scope, MoveTemp(Delegate));
+    }
+    
+    /** Subscribe to bool changes of a tag; see SubscribeToTypedTag */
+    FTagValueSubscriptionHandle OnBoolChanged(FGameplayTag Tag, FOnBoolTagValueChanged Delegate, ETagValueSubscriptionScope Scope = ETagValueSubscriptionScope::ExactTag)
+    {
+        return SubscribeToTypedTag<bool>(Tag, Scope, MoveTemp(Delegate));
+    }
+    
+    /**
+     * Subscribe to changes of a tag
+     * Only changes matching the tag and scope are delivered, including changes committed by a write batch
+     * and removals caused by clearing a repository.
+     * @param Tag The tag to subscribe to
+     * @param Scope Whether changes to descendants of the tag are included
+     * @param Delegate The event to call on change
+     * @return Handle for UnsubscribeFromTag
+     */
+    UFUNCTION(BlueprintCallable, Category = "Gameplay Tags|Values", meta = (DisplayName = "Subscribe To Tag"))
+    FTagValueSubscriptionHandle K2_SubscribeToTag(FGameplayTag Tag, ETagValueSubscriptionScope Scope, FOnTagValueChangedDynamic Delegate);
+    
+    /**
+     * Remove a subscription made with SubscribeToTag
+     * @param Handle The handle returned when subscribing; reset on return
+     * @return True if the subscription existed
+     */
+    UFUNCTION(BlueprintCallable, Category = "Gameplay Tags|Values")
+    bool UnsubscribeFromTag(UPARAM(ref) FTagValueSubscriptionHandle& Handle);
+    
+    /**
+     * Set when tag value change notifications are delivered
+     * In EndOfFrame mode, changes are collected per tag and repository and delivered once at the end
+     * of the frame with the final value, including changes made inside write batches.
+     * Switching back to Immediate delivers any collected changes first.
+     * @param Mode The dispatch mode to use
+     */
+    UFUNCTION(BlueprintCallable, Category = "Gameplay Tags|Values")
+    void SetChangeDispatchMode(ETagValueChangeDispatchMode Mode);
+    
+    /** @return When tag value change notifications are delivered */
+    UFUNCTION(BlueprintPure, Category = "Gameplay Tags|Values")
+    ETagValueChangeDispatchMode GetChangeDispatchMode() const { return ChangeDispatchMode; }
+    
+    /**
+     * Deliver the changes collected in EndOfFrame mode now
+     * Called automatically at the end of every frame; can be called from a tick to deliver earlier.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Gameplay Tags|Values")
+    void FlushDeferredChanges();
+    
+    /**
+     * Set the time budget for delivering deferred changes
+     * In EndOfFrame mode, changes that do not fit in the budget are carried over to the next frame.
+     * At least one change is delivered per flush so delivery always makes progress.
+     * @param BudgetMilliseconds The budget per flush, or 0 for no limit
+     */
+    UFUNCTION(BlueprintCallable, Category = "Gameplay Tags|Values")
+    void SetChangeDispatchBudget(float BudgetMilliseconds);
+    
+    /**
+     * Set how long a change listener may take before it is reported as slow
+     * Slow subscribers are logged with their bound object and function. The OnTagValueChanged and
+     * OnTagValueChangedNative events can only be timed as a whole; OnTagValueChanged also logs each bound object and function.
+     * @param ThresholdMilliseconds The threshold, or 0 to disable timing
+     */
+    UFUNCTION(BlueprintCallable, Category = "Gameplay Tags|Values|Debug")
+    void SetSlowListenerThreshold(float ThresholdMilliseconds);
+    
+    /** @return The number of changes waiting to be delivered */
+    UFUNCTION(BlueprintPure, Category = "Gameplay Tags|Values|Debug")
+    int32 GetNumPendingChanges() const { return PendingChanges.Num(); }
+    
+    /**
+     * Enable or disable the frame snapshot
+     * At the end of every frame in which values changed, the resolved values are written into a read-only
+     * snapshot. Any thread can read it without locking through TryGetFrameValue and the GetFrame*Value
+     * functions, seeing the values as of the end of the previous frame, while the game thread keeps
+     * writing to the repositories. Readers are counted, so a buffer is never updated while a read is in
+     * it; if a reader is still in the back buffer at the end of a frame, publishing waits for a later frame.
+     * Publishing only resolves the subtrees of tags changed through the subsystem since the buffer was
+     * last published; a tag tree change or a write made directly on a repository resolves every tag once.
+     * @param bEnabled True to publish the snapshot
+     */
+    UFUNCTION(BlueprintCallable, Category = "Gameplay Tags|Values")
+    void SetFrameSnapshotEnabled(bool bEnabled);
+    
+    /** @return True if the frame snapshot is published */
+    UFUNCTION(BlueprintPure, Category = "Gameplay Tags|Values")
+    bool IsFrameSnapshotEnabled() const { return bFrameSnapshotEnabled.load(std::memory_order_relaxed); }
+    
+    /**
+     * Read a value from the frame snapshot; safe to call from any thread
+     * Values inherited from parent tags are resolved when the snapshot is published, as with TryGetRaw,
+     * so reads do not walk the hierarchy or use the tag manager. Context objects are not consulted.
+     * @param Tag The tag to read
+     * @param OutValue Receives the value if found
+     * @return True if the snapshot holds a value of type T for the tag or its closest parent with a value
+     */
+    template<typename T>
+    bool TryGetFrameValue(FGameplayTag Tag, T& OutValue) const
+    {
+        if (!bFrameSnapshotReadable.load(std::memory_order_acquire))
+        {
+            return false;
+        }
+        
+        // Counted as a reader of the front buffer, so the publisher leaves it alone until the read is done
+        const FTagValueReaderEpoch::FReadScope ReadScope(FrameSnapshotEpoch);
+        const FFrameSnapshot& Snapshot = FrameSnapshots[ReadScope.GetEpoch() & 1];
+        const int32* Index = Snapshot.TagIndices.Find(Tag);
+        return Index && Snapshot.Values[*Index].TryGet(OutValue);
+    }
+    
+    /**
+     * Get a bool value from the frame snapshot; safe to call from any thread, including animation fast-path code
+     * @param Tag The tag to get the value for
+     * @param DefaultValue The value to return if the snapshot holds no bool value for the tag
+     * @return The value as of the end of the previous frame, or DefaultValue
+     */
+    UFUNCTION(BlueprintPure, Category = "Gameplay Tags|Values|Thread Safe", meta = (BlueprintThreadSafe))
+    bool GetFrameBoolValue(FGameplayTag Tag, bool DefaultValue = false) const;
+    
+    /**
+     * Get an integer value from the frame snapshot; safe to call from any thread, including animation fast-path code
+     * @param Tag The tag to get the value for
+     * @param DefaultValue The value to return if the snapshot holds no integer value for the tag
+     * @return The value as of the end of the previous frame, or DefaultValue
+     */
+    UFUNCTION(BlueprintPure, Category = "Gameplay Tags|Values|Thread Safe", meta = (BlueprintThreadSafe))
+    int32 GetFrameIntValue(FGameplayTag Tag, int32 DefaultValue = 0) const;
+    
+    /**
+     * Get a float value from the frame snapshot; safe to call from any thread, including animation fast-path code
+     * @param Tag The tag to get the value for
+     * @param DefaultValue The value to return if the snapshot holds no float value for the tag
+     * @return The value as of the end of the previous frame, or DefaultValue
+     */
+    UFUNCTION(BlueprintPure, Category = "Gameplay Tags|Values|Thread Safe", meta = (BlueprintThreadSafe))
+    float GetFrameFloatValue(FGameplayTag Tag, float DefaultValue = 0.0f) const;
+    
+    /**
+     * Get a transform value from the frame snapshot; safe to call from any thread, including animation fast-path code
+     * @param Tag The tag to get the value for
+     * @param DefaultValue The value to return if the snapshot holds no transform value for the tag
+     * @return The value as of the end of the previous frame, or DefaultValue
+     */
+    UFUNCTION(BlueprintPure, Category = "Gameplay Tags|Values|Thread Safe", meta = (BlueprintThreadSafe))
+    FTransform GetFrameTransformValue(FGameplayTag Tag, const FTransform& DefaultValue) const;
+    
+    /**
+     * Start a write batch
+     * Values set, removed or cleared until the matching CommitBatch are staged and applied together, in order, on commit,
+     * and the changes are announced on commit through OnTagValueChanged, then with a single OnTagValuesBatchChanged event.
+     * Batches may be nested; only the outermost commit applies the staged writes.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Gameplay Tags|Values")
+    void BeginBatch();
+    
+    /**
+     * Commit the write batch started by the matching BeginBatch
+     */
+    UFUNCTION(BlueprintCallable, Category = "Gameplay Tags|Values")
+    void CommitBatch();
+    
+    /** @return True while a write batch is open */
+    UFUNCTION(BlueprintPure, Category = "Gameplay Tags|Values")
+    bool IsInBatch() const { return BatchDepth > 0; }
+    
     /**
      * Broadcast that a tag value has changed
      * @param Tag The tag that changed
@@ -317,15 +891,378 @@ public:
      */
     void BroadcastTagValueChanged(FGameplayTag Tag, FName RepositoryName, const TSharedPtr<ITagValueHolder>& OldValue = nullptr, const TSharedPtr<ITagValueHolder>& NewValue = nullptr);
     
+    /**
+     * Get the hit and miss counts of the resolution cache used by GetRawValue and HasTagValue
+     * @param OutHits Number of lookups served from the cache
+     * @param OutMisses Number of lookups that had to walk the repositories
+     */
+    UFUNCTION(BlueprintCallable, Category = "Gameplay Tags|Values|Debug")
+    void GetResolutionCacheStats(int64& OutHits, int64& OutMisses) const;
+    
+    /** Reset the resolution cache hit and miss counters */
+    UFUNCTION(BlueprintCallable, Category = "Gameplay Tags|Values|Debug")
+    void ResetResolutionCacheStats();
+    
+    /**
+     * Enable or disable the effective value table
+     * The table holds the resolved value of every registered tag, including values inherited from
+     * ancestors, so reads become a single indexed load. Entries are resolved when first read.
+     * Writes, removals, clears and repository registration through the subsystem mark only the
+     * affected subtrees stale; changes made directly on a repository mark the whole table stale
+     * in constant time. Either way, stale entries are resolved again one by one as they are read.
+     * @param bEnabled True to maintain the table
+     */
+    UFUNCTION(BlueprintCallable, Category = "Gameplay Tags|Values")
+    void SetEffectiveValueTableEnabled(bool bEnabled);
+    
+    /** @return True if the effective value table is maintained */
+    UFUNCTION(BlueprintPure, Category = "Gameplay Tags|Values")
+    bool IsEffectiveValueTableEnabled() const { return bEffectiveValueTableEnabled; }
+
 private:
+    /** Result of a hierarchical lookup across all repositories */
+    struct FTagValueResolution
+    {
+        /** The repository that provided the value, or nullptr if no repository has one */
+        ITagValueRepository* Repository = nullptr;
+        
+        /** The tag the value was found on (the requested tag or one of its ancestors) */
+        FGameplayTag ResolvedTag;
+        
+        /** The resolved value */
+        FTagValueVariant Value;
+    };
+    
+    
     /** The default repository name */
     static const FName DefaultRepositoryName;
     
     /** Map of repository names to repositories */
     TMap<FName, TSharedPtr<ITagValueRepository>> Repositories;
     
+    /** Non-owning repository list sorted by priority (highest first), rebuilt on register/unregister */
+    TArray<ITagValueRepository*> SortedRepositories;
+    
+    /** Rebuild SortedRepositories from Repositories */
+    void RebuildSortedRepositories();
+    
+    /** Bumped whenever the priority order or the tag tree changes, but not on value writes */
+    uint32 RepositoryLayoutGeneration = 0;
+    
+    /**
+     * Get a stamp that changes whenever any registered repository is written to or the layout changes
+     * Combines the layout generation with the sum of the repository generations, so it costs one load per repository.
+     */
+    uint64 GetRepositoryStamp() const;
+    
+    /** A cached resolution with the repositories it depends on */
+    struct FCachedTagValueResolution
+    {
+        FTagValueResolution Resolution;
+        
+        /** Repositories that could change the resolution, at their generation when it was made */
+        FTagValueRepositoryDependencies Dependencies;
+    };
+    
+    /**
+     * Record the repositories a resolution depends on
+     * A value found on the tag itself can only be shadowed by the repositories checked before it;
+     * a value inherited from a parent (or no value) can be shadowed by a write to any repository.
+     */
+    void GatherDependencies(const FGameplayTag& Tag, const FTagValueResolution& Resolution, FTagValueRepositoryDependencies& OutDependencies) const;
+    
+    /** Cached hierarchical lookups; an entry is used while its dependencies are unchanged, and all are dropped when the layout changes */
+    mutable TMap<FGameplayTag, FCachedTagValueResolution> ResolutionCache;
+    
+    /** Resolution cache statistics */
+    mutable int64 ResolutionCacheHits = 0;
+    mutable int64 ResolutionCacheMisses = 0;
+    
+    /**
+     * Resolve a tag across repositories and its parent tags, using the effective value table or the resolution cache
+     * @param Tag The tag to resolve
+     * @param TagIndex The tag's dense index if the caller has it cached, or INDEX_NONE to look it up
+     * @return A copy of the resolution; the cache entry it came from may move on the next lookup
+     */
+    FTagValueResolution ResolveTag(FGameplayTag Tag, int32 TagIndex = INDEX_NONE) const;
+    
+    /** Whether the effective value table is maintained */
+    bool bEffectiveValueTableEnabled = false;
+    
+    /** An entry of the effective value table */
+    struct FEffectiveTagValue
+    {
+        FTagValueResolution Resolution;
+        
+        /** Table epoch the resolution was made in; the entry is stale if it differs from EffectiveValuesEpoch */
+        uint32 Epoch = 0;
+    };
+    
+    /** Resolution of every registered tag, by dense tag index */
+    mutable TArray<FEffectiveTagValue> EffectiveValues;
+    
+    /** Current epoch of the effective value table; bumping it marks every entry stale */
+    mutable uint32 EffectiveValuesEpoch = 1;
+    
+    /** Repository stamp the effective value table is up to date with */
+    mutable uint64 EffectiveValuesStamp = 0;
+    
+    /** False when the effective value table must be resized for the tag tree regardless of the generation */
+    mutable bool bEffectiveValuesValid = false;
+    
+    /** @return True if the effective value table is enabled and reflects every repository change up to a repository stamp */
+    bool IsEffectiveValueTableInSync(uint64 Stamp) const;
+    
+    /** A repository consulted while resolving a tag, with its membership filter if it maintains one */
+    struct FResolveCandidate
+    {
+        ITagValueRepository* Repository = nullptr;
+        const FTagValueMembershipFilter* Filter = nullptr;
+    };
+    using FResolveCandidates = TArray<FResolveCandidate, TInlineAllocator<8>>;
+    
+    /**
+     * Collect the repositories, in priority order, that may hold values for a tag
+     * @param RootIndex Dense index of the root tag above the tag; repositories with nothing below it are skipped
+     * @param OutCandidates Receives the repositories
+     */
+    void GatherResolveCandidates(int32 RootIndex, FResolveCandidates& OutCandidates) const;
+    
+    /**
+     * Probe the candidates for a value stored exactly on a tag, skipping those whose filter rules it out
+     * @return True if a value was found and written to OutResolution
+     */
+    bool FindInCandidates(const FGameplayTag& Tag, int32 TagIndex, const FResolveCandidates& Candidates, FTagValueResolution& OutResolution) const;
+    
+    /** Resolve the tag at a dense index across repositories and its parent tags without any caching */
+    void ComputeResolution(int32 TagIndex, FTagValueResolution& OutResolution) const;
+    
+    /**
+     * Find a tag's entry in the effective value table, resolving it first if it is stale
+     * @return The resolution, or nullptr if the tag is not in the table
+     */
+    const FTagValueResolution* FindEffectiveValue(const FGameplayTag& Tag, int32 TagIndex) const;
+    
+    /** Size the effective value table for the tag tree and mark it stale if repositories changed behind the subsystem's back */
+    void SyncEffectiveValues() const;
+    
+    /** Mark every entry of the effective value table stale in constant time */
+    void InvalidateEffectiveValues() const;
+    
+    /**
+     * Bring the effective value table up to date after tags changed through the subsystem
+     * @param bWasInSync Whether the table was in sync before the change; if not the next read marks the whole table stale
+     * @param ChangedTags Tags whose own value changed; their subtrees are marked stale
+     */
+    void UpdateEffectiveValues(bool bWasInSync, TArrayView<const FGameplayTag> ChangedTags);
+    
+    /**
+     * Bring the effective value table and the frame snapshot up to date after tags changed through the subsystem
+     * @param StampBefore The repository stamp taken before the change
+     * @param ChangedTags Tags whose own value changed
+     */
+    void HandleTagValuesChanged(uint64 StampBefore, TArrayView<const FGameplayTag> ChangedTags);
+    
+    /** Mark the effective value table and the frame snapshot stale as a whole, after any tag may have changed */
+    void HandleAllTagValuesChanged();
+    
+    /** What a staged or queued write does */
+    enum class EStagedWriteKind : uint8
+    {
+        /** Set the value of the tag in the repository */
+        Set,
+        
+        /** Remove the value of the tag from the repository, or from every repository if none is named */
+        Remove,
+        
+        /** Clear the repository, or every repository if none is named; the write has no tag */
+        Clear,
+    };
+    
+    /** A write staged by an open batch, or queued from another thread */
+    struct FStagedTagValueWrite
+    {
+        FGameplayTag Tag;
+        FName RepositoryName;
+        TSharedPtr<ITagValueHolder> Value;
+        EStagedWriteKind Kind = EStagedWriteKind::Set;
+    };
+    
+    /** Number of nested BeginBatch calls that have not been committed */
+    int32 BatchDepth = 0;
+    
+    /** Writes staged by the open batch, in the order they were made */
+    TArray<FStagedTagValueWrite> StagedWrites;
+    
+    /** Writes queued from any thread, waiting for the game thread; only sets and removals are queued */
+    TQueue<FStagedTagValueWrite, EQueueMode::Mpsc> QueuedWrites;
+    
+    /** Handle of the end of frame callback that drains QueuedWrites */
+    FDelegateHandle QueuedWritesHandle;
+    
+    /** When change notifications are delivered */
+    ETagValueChangeDispatchMode ChangeDispatchMode = ETagValueChangeDispatchMode::Immediate;
+    
+    /** Handle of the end of frame callback used in EndOfFrame mode */
+    FDelegateHandle EndOfFrameHandle;
+    
+    /** Whether the frame snapshot is published at the end of every frame */
+    std::atomic<bool> bFrameSnapshotEnabled = false;
+    
+    /** Whether the front buffer holds values published since the snapshot was last enabled; read by other threads */
+    std::atomic<bool> bFrameSnapshotReadable = false;
+    
+    /** One buffer of the frame snapshot */
+    struct FFrameSnapshot
+    {
+        /** Resolved value of every registered tag, including inherited values, by dense tag index */
+        TArray<FTagValueVariant> Values;
+        
+        /** Dense index of every registered tag, so readers never go through the tag manager */
+        TMap<FGameplayTag, int32> TagIndices;
+        
+        /** Dense indices of tags changed since the buffer was last published; their subtrees are resolved again */
+        TSet<int32> ChangedTagIndices;
+        
+        /** Repository stamp the buffer was last published at */
+        uint64 Stamp = 0;
+        
+        /** Set when the buffer must resolve every tag before it is published again */
+        bool bNeedsRebuild = true;
+    };
+    
+    /** Double-buffered resolved values: the front buffer is read by other threads, the back one is patched */
+    FFrameSnapshot FrameSnapshots[2];
+    
+    /**
+     * Counts the readers of each buffer; the parity of its epoch is the index of the front buffer
+     * The back buffer is only patched once the readers that entered it before the last publish have left.
+     */
+    FTagValueReaderEpoch FrameSnapshotEpoch;
+    
+    /** Repository stamp after the last change recorded for the frame snapshot; a mismatch means a change went unrecorded */
+    uint64 FrameSnapshotTrackedStamp = 0;
+    
+    /** Handle of the end of frame callback that publishes the frame snapshot */
+    FDelegateHandle FrameSnapshotHandle;
+    
+    /** Bring the back buffer up to date and make it the front buffer, if anything changed and its readers have left */
+    void PublishFrameSnapshot();
+    
+    /**
+     * Record tags changed through the subsystem for both frame snapshot buffers
+     * @param StampBefore The repository stamp taken before the change; if changes went unrecorded, both buffers are rebuilt instead
+     * @param ChangedTags Tags whose own value changed
+     */
+    void RecordFrameSnapshotChanges(uint64 StampBefore, TArrayView<const FGameplayTag> ChangedTags);
+    
+    /** Mark both frame snapshot buffers to resolve every tag when they are next published */
+    void InvalidateFrameSnapshots();
+    
+    /** Resolve every registered tag into a frame snapshot buffer */
+    void RebuildFrameSnapshot(FFrameSnapshot& Snapshot) const;
+    
+    /** Resolve the subtrees of the tags changed since a frame snapshot buffer was last published */
+    void PatchFrameSnapshot(FFrameSnapshot& Snapshot) const;
+    
+    /** Time budget in seconds for delivering deferred changes per flush; 0 for no limit */
+    double ChangeDispatchBudget = 0.0;
+    
+    /** Listeners taking longer than this many seconds are reported; 0 disables timing */
+    double SlowListenerThreshold = 0.0;
+    
+    /** Tags changed by the pending changes */
+    FGameplayTagContainer PendingChangedTags;
+    
+    /** A change not yet announced; holds the values alive until it is delivered. A change without a tag is a repository clear. */
+    struct FPendingTagValueChange
+    {
+        FGameplayTag Tag;
+        FName RepositoryName;
+        TSharedPtr<ITagValueHolder> OldValue;
+        TSharedPtr<ITagValueHolder> NewValue;
+        
+        /** For a clear, the values the repository held, or null if nobody subscribed to its tags */
+        TSharedPtr<ITagValueRepository> ClearedValues;
+    };
+    
+    /**
+     * Changes made inside the open batch or this frame, one per tag and repository, from the first old to the last new value
+     * A clear is recorded once, in order, and absorbs the earlier changes of its repository.
+     */
+    TArray<FPendingTagValueChange> PendingChanges;
+    
+    /** Index into PendingChanges by tag and repository */
+    TMap<TPair<FGameplayTag, FName>, int32> PendingChangeIndex;
+    
+    /** Per-tag subscriptions to value changes */
+    FTagValueSubscriptionRegistry Subscriptions;
+    
+    /** Ancestor chain of every registered tag, used by hierarchical resolution */
+    FTagValueAncestorTable AncestorTable;
+    
+    /** Handle of the tag tree change callback that rebuilds the ancestor table */
+    FDelegateHandle TagTreeChangedHandle;
+    
+    /** Rebuild the ancestor table after the tag tree changed */
+    void HandleTagTreeChanged();
+    
+    /** Deliver a change to subscribers and native listeners */
+    void DispatchTagValueChange(const FTagValueChangeEvent& Event);
+    
+    /** Broadcast OnTagValueChanged for a change, timing it if slow listener detection is enabled */
+    void BroadcastDynamicTagValueChanged(FGameplayTag Tag, FName RepositoryName);
+    
+    /**
+     * Log a slow multicast event with the functions bound to it
+     * @param Bindings The bound Object.Function entries, or empty when the event cannot list them
+     */
+    void ReportSlowListeners(const TCHAR* EventName, const FString& Bindings, double Elapsed, FGameplayTag Tag) const;
+    
+    /** Clear a repository and announce it with a single event */
+    void ClearRepository(ITagValueRepository& Repository);
+    
+    /**
+     * Fold the pending changes of a repository into its clear, so each tag is reported once
+     * @param ClearedValues The values handed over by the clear; each folded tag gets back the old value listeners last heard of
+     */
+    void FoldPendingChangesIntoClear(FName RepositoryName, ITagValueRepository* ClearedValues);
+    
+    /** Tell subscribers and listeners that a repository was cleared */
+    void DispatchRepositoryCleared(FName RepositoryName, const ITagValueRepository* ClearedValues);
+    
+    /** Put changes that did not fit in the dispatch budget back in front of the pending changes */
+    void RequeuePendingChanges(TArrayView<FPendingTagValueChange> Changes);
+    
+    /** Record a change to be delivered later, merging it with an earlier change to the same tag and repository */
+    void AddPendingChange(FGameplayTag Tag, FName RepositoryName, const TSharedPtr<ITagValueHolder>& OldValue, const TSharedPtr<ITagValueHolder>& NewValue);
+    void AddPendingChange(FPendingTagValueChange&& Change);
+    
+    /**
+     * Deliver the pending changes
+     * Each change is announced through OnTagValueChanged and its subscribers, each clear through OnRepositoryCleared
+     * @param bAsBatch True to deliver a committed batch in full and then announce it through OnTagValuesBatchChanged,
+     * false to respect the dispatch budget
+     */
+    void FlushPendingChanges(bool bAsBatch);
+    
+    /** Apply a raw value to a repository and broadcast the change */
+    void ApplyRawValue(ITagValueRepository& Repository, FGameplayTag Tag, const TSharedPtr<ITagValueHolder>& Value);
+    
+    /** Apply the writes staged by the open batch, in the order they were made */
+    void FlushStagedWrites();
+    
+    /** Remove a tag's value from one repository or from all of them, and broadcast the changes */
+    bool ApplyRemoveValue(FGameplayTag Tag, FName RepositoryName);
+    
+    /** Clear one repository or all of them */
+    void ApplyClearAllValues(FName RepositoryName);
+    
     /** Get the best repository for setting values */
-    TSharedPtr<ITagValueRepository> GetBestRepository(FName RepositoryName = NAME_None) const;
+    ITagValueRepository* GetBestRepository(FName RepositoryName = NAME_None) const;
+    
+    /** Check that a repository is still registered, after listeners had a chance to unregister it */
+    bool IsRepositoryRegistered(const ITagValueRepository& Repository) const;
     
     /** Check if an object implements the UTagValueInterface */
     bool ImplementsTagValueInterface(UObject* Object) const;
@@ -341,11 +1278,49 @@ private:
     template<typename T>
     bool TryGetValueFromRepositories(FGameplayTag Tag, T& OutValue) const;
     
+    /** Helper function for getting a typed value in a single resolution pass */
+    template<typename TagValueType>
+    bool TryGetTypedValue(FGameplayTag Tag, typename TagValueType::ValueType& OutValue, UObject* Context) const;
+    
+    /** Helper function for getting the typed values of a tag container */
+    template<typename TagValueType>
+    int32 GetTypedValuesForTags(const FGameplayTagContainer& Tags, TMap<FGameplayTag, typename TagValueType::ValueType>& OutValues) const;
+    
     /** Helper function for getting a typed value */
-    template<typename T>
-    T GetTypedValue(FGameplayTag Tag, const T& DefaultValue, UObject* Context) const;
+    template<typename TagValueType>
+    typename TagValueType::ValueType GetTypedValue(FGameplayTag Tag, const typename TagValueType::ValueType& DefaultValue, UObject* Context) const;
     
     /** Helper function for setting a typed value */
-    template<typename T>
-    bool SetTypedValue(FGameplayTag Tag, const T& Value, FName RepositoryName);
-};
\ No newline at end of file
+    template<typename TagValueType>
+    bool SetTypedValue(FGameplayTag Tag, const typename TagValueType::ValueType& Value, FName RepositoryName);
+};
+
+/**
+ * Scoped write batch on a tag value subsystem
+ * Opens a batch on construction and commits it when it goes out of scope
+ */
+class GAMPLAYTAGVALUE_API FTagValueWriteBatch
+{
+public:
+    explicit FTagValueWriteBatch(UGameplayTagValueSubsystem* InSubsystem)
+        : Subsystem(InSubsystem)
+    {
+        if (Subsystem)
+        {
+            Subsystem->BeginBatch();
+        }
+    }
+    
+    ~FTagValueWriteBatch()
+    {
+        if (Subsystem)
+        {
+            Subsystem->CommitBatch();
+        }
+    }
+    
+    UE_NONCOPYABLE(FTagValueWriteBatch);
+
+private:
+    UGameplayTagValueSubsystem* Subsystem;
+};
@@ -41,6 +41,9 @@ private:
 	/** Handle to the registered BlueprintNodeFactories delegate */
 	FDelegateHandle BlueprintNodeFactoriesHandle;
 
+	/** Handle to the tag tree changed delegate */
+	FDelegateHandle TagTreeChangedHandle;
+
 	/** Names of repositories created by this module */
 	TArray<FName> CreatedRepositoryNames;
 };
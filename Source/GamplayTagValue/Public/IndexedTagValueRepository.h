@@ -0,0 +1,76 @@
+// Copyright 2025 Nguyen Phi Hung. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTags.h"
+#include "TagValueInterface.h"
+#include "TagValueVariant.h"
+
+/**
+ * Memory-based repository that addresses values directly by the tag's dense index
+ * Values live in a flat slot array with an occupancy bitset. Bool, int and float values are
+ * stored inline in the slot; larger values keep a shared holder.
+ * Looking a slot up by tag still resolves the dense index through the tag manager, which is a hash
+ * probe. Callers that already know the index (TryGetRawAt, e.g. with an FTagValueIndexedTag, and the
+ * subsystem's ancestor walks) skip it, and the lookup is then an array access and a tag compare.
+ * Slots are re-addressed automatically when the gameplay tag tree changes.
+ */
+class GAMPLAYTAGVALUE_API FIndexedTagValueRepository : public ITagValueRepository
+{
+public:
+    FIndexedTagValueRepository(const FName& InName, int32 InPriority);
+    virtual ~FIndexedTagValueRepository();
+    
+    // ITagValueRepository interface
+    virtual bool HasValue(FGameplayTag Tag) const override;
+    virtual TSharedPtr<ITagValueHolder> GetValue(FGameplayTag Tag) const override;
+    virtual bool TryGetRaw(FGameplayTag Tag, FTagValueVariant& OutValue) const override;
+    virtual bool TryGetRawAt(FGameplayTag Tag, int32 TagIndex, FTagValueVariant& OutValue) const override;
+    virtual void SetValue(FGameplayTag Tag, TSharedPtr<ITagValueHolder> Value) override;
+    virtual void RemoveValue(FGameplayTag Tag) override;
+    virtual void ClearAllValues() override;
+    virtual TArray<FGameplayTag> GetAllTags() const override;
+    virtual FName GetRepositoryName() const override;
+    virtual int32 GetPriority() const override;
+    
+private:
+    /** A single addressable value slot */
+    struct FSlot
+    {
+        /** The tag stored in this slot, used to detect stale indices */
+        FGameplayTag Tag;
+        
+        /** The stored value */
+        FTagValueVariant Value;
+    };
+    
+    /**
+     * Find the occupied slot for a tag
+     * @param Tag The tag to look up
+     * @param Index The tag's dense index, possibly stale
+     * @return The slot, or nullptr if the tag has no value
+     */
+    const FSlot* FindSlot(const FGameplayTag& Tag, int32 Index) const;
+    
+    /** Store a value in the tag's slot, growing the slot array if needed */
+    void PlaceValue(const FGameplayTag& Tag, FTagValueVariant&& Value);
+    
+    /** Re-address all slots after the tag tree (and therefore the tag indices) changed */
+    void Reindex();
+    
+    /** Slots addressed by tag index */
+    TArray<FSlot> Slots;
+    
+    /** One bit per slot, set when the slot holds a value */
+    TBitArray<> Occupied;
+    
+    /** Name of this repository */
+    FName RepositoryName;
+    
+    /** Priority of this repository */
+    int32 Priority;
+    
+    /** Handle for the tag tree changed delegate */
+    FDelegateHandle TagTreeChangedHandle;
+};
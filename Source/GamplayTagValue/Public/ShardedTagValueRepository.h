@@ -0,0 +1,76 @@
+// Copyright 2025 Nguyen Phi Hung. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTags.h"
+#include "TagValueInterface.h"
+
+/**
+ * Memory-based repository that can be read and written from many threads at once
+ * Tags are partitioned by hash into independently locked shards, each guarded by a reader-writer
+ * lock, so threads working on different tags rarely contend and readers of one shard never block
+ * each other. Each shard sits on its own cache line to avoid false sharing between threads.
+ * Values are copied on the way in and out, so no thread can modify a holder another thread is reading.
+ *
+ * Changes made from other threads are not announced by the subsystem, and the subsystem's caches
+ * are game-thread only: read through the repository itself while other threads are writing.
+ */
+class GAMPLAYTAGVALUE_API FShardedTagValueRepository : public ITagValueRepository
+{
+public:
+    /** Number of shards used when none is given */
+    static constexpr int32 DefaultNumShards = 16;
+    
+    /**
+     * @param InName Name of the repository
+     * @param InPriority Priority of the repository
+     * @param InNumShards Number of shards, rounded up to a power of two; more shards means less contention
+     */
+    FShardedTagValueRepository(const FName& InName, int32 InPriority, int32 InNumShards = DefaultNumShards);
+    
+    UE_NONCOPYABLE(FShardedTagValueRepository);
+    
+    // ITagValueRepository interface; every function is safe to call from any thread
+    virtual bool HasValue(FGameplayTag Tag) const override;
+    virtual TSharedPtr<ITagValueHolder> GetValue(FGameplayTag Tag) const override;
+    virtual bool TryGetRaw(FGameplayTag Tag, FTagValueVariant& OutValue) const override;
+    virtual void SetValue(FGameplayTag Tag, TSharedPtr<ITagValueHolder> Value) override;
+    virtual void RemoveValue(FGameplayTag Tag) override;
+    virtual void ClearAllValues() override;
+    virtual TArray<FGameplayTag> GetAllTags() const override;
+    virtual FName GetRepositoryName() const override;
+    virtual int32 GetPriority() const override;
+    
+    /** @return The number of shards */
+    int32 GetNumShards() const { return ShardMask + 1; }
+
+private:
+    /** An independently locked partition of the values */
+    struct alignas(PLATFORM_CACHE_LINE_SIZE) FShard
+    {
+        /** Guards Values */
+        mutable FRWLock Lock;
+        
+        /** Values of the tags that hash to this shard */
+        TMap<FGameplayTag, TSharedPtr<ITagValueHolder>> Values;
+    };
+    
+    /** Get the shard a tag belongs to */
+    FShard& GetShard(const FGameplayTag& Tag) const
+    {
+        return Shards[MurmurFinalize32(GetTypeHash(Tag)) & ShardMask];
+    }
+    
+    /** The shards */
+    TUniquePtr<FShard[]> Shards;
+    
+    /** Number of shards minus one; shard counts are powers of two */
+    int32 ShardMask;
+    
+    /** Name of this repository */
+    FName RepositoryName;
+    
+    /** Priority of this repository */
+    int32 Priority;
+};
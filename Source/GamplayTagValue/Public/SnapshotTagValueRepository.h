@@ -0,0 +1,125 @@
+// Copyright 2025 Nguyen Phi Hung. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTags.h"
+#include "TagValueInterface.h"
+#include "TagValueReaderEpoch.h"
+#include "TagValueTagIndex.h"
+#include "TagValueVariant.h"
+#include <atomic>
+
+/**
+ * Memory-based repository whose reads are safe from any thread and never lock
+ * Readers load the currently published snapshot through an atomic pointer and never wait for a writer,
+ * so animation worker threads and parallel gameplay jobs can read while the game thread writes.
+ * Writers copy the current snapshot, apply their change and publish the copy (read-copy-update).
+ * A replaced snapshot is retired to an FTagValueReaderEpoch and freed once every reader that could
+ * have loaded it has left, however long a read on a worker thread takes.
+ * Parent tags are looked up in a map captured with the snapshot, so hierarchical reads never
+ * touch the tag manager off the game thread.
+ *
+ * Every write copies the whole snapshot, so this backend suits values that are read far more
+ * often than they are written. Use SetValues to apply many writes with a single copy.
+ * Writers are serialized by a lock and may run on any thread. Changes made from other threads are
+ * not announced by the subsystem, and the subsystem's caches are game-thread only: read through the
+ * repository itself while other threads are writing.
+ */
+class GAMPLAYTAGVALUE_API FSnapshotTagValueRepository : public ITagValueRepository
+{
+public:
+    FSnapshotTagValueRepository(const FName& InName, int32 InPriority);
+    virtual ~FSnapshotTagValueRepository();
+    
+    UE_NONCOPYABLE(FSnapshotTagValueRepository);
+    
+    // ITagValueRepository interface; the read functions are safe to call from any thread
+    virtual bool HasValue(FGameplayTag Tag) const override;
+    virtual TSharedPtr<ITagValueHolder> GetValue(FGameplayTag Tag) const override;
+    virtual bool TryGetRaw(FGameplayTag Tag, FTagValueVariant& OutValue) const override;
+    virtual void SetValue(FGameplayTag Tag, TSharedPtr<ITagValueHolder> Value) override;
+    virtual void RemoveValue(FGameplayTag Tag) override;
+    virtual void ClearAllValues() override;
+    virtual TArray<FGameplayTag> GetAllTags() const override;
+    virtual FName GetRepositoryName() const override;
+    virtual int32 GetPriority() const override;
+    
+    /**
+     * Set many values with a single copy of the snapshot
+     * @param Values The tags and values to write; invalid holders remove the tag
+     */
+    void SetValues(TArrayView<const TPair<FGameplayTag, TSharedPtr<ITagValueHolder>>> Values);
+    
+    /**
+     * Resolve a tag against this repository only, falling back to its parent tags
+     * Safe to call from any thread. The tag and all of its parents are read from the same snapshot.
+     * @param Tag The tag to resolve
+     * @param OutValue Receives the value of the tag or its closest parent that has one
+     * @return True if a value was found
+     */
+    bool TryResolveRaw(FGameplayTag Tag, FTagValueVariant& OutValue) const;
+    
+    /**
+     * Read a typed value; safe to call from any thread
+     * @param Tag The tag to read
+     * @param OutValue Receives the value if found
+     * @return True if a value of type T is stored for the tag
+     */
+    template<typename T>
+    bool TryGetTypedValue(FGameplayTag Tag, T& OutValue) const
+    {
+        const FTagValueReaderEpoch::FReadScope ReadScope(ReaderEpoch);
+        const FTagValueVariant* Value = GetSnapshot().Values.Find(Tag);
+        return Value && Value->TryGet(OutValue);
+    }
+
+private:
+    /** An immutable published set of values */
+    struct FSnapshot
+    {
+        TMap<FGameplayTag, FTagValueVariant> Values;
+        
+        /** Parents of every tag as of the last tag tree change, shared between snapshots */
+        TSharedPtr<const FTagValueParentMap, ESPMode::ThreadSafe> Parents;
+    };
+    
+    /** Get the published snapshot; it stays alive for as long as the caller holds a read scope of ReaderEpoch */
+    const FSnapshot& GetSnapshot() const
+    {
+        return *Current.load(std::memory_order_acquire);
+    }
+    
+    /** Convert a holder into a variant that owns a private copy of out-of-line values */
+    static FTagValueVariant MakeImmutableValue(const TSharedPtr<ITagValueHolder>& Holder);
+    
+    /** Swap in a new snapshot and retire the previous one; WriterLock must be held */
+    void Publish(TUniquePtr<const FSnapshot> NextSnapshot);
+    
+    /** Publish a copy of the current values with the parents of the new tag tree */
+    void HandleTagTreeChanged();
+    
+    /** Free retired snapshots at the end of the frame, when no write came along to do it */
+    void HandleEndFrame();
+    
+    /** The snapshot readers see; only replaced by writers holding WriterLock */
+    std::atomic<const FSnapshot*> Current;
+    
+    /** Keeps replaced snapshots alive for readers that may still be using them; retiring is guarded by WriterLock */
+    FTagValueReaderEpoch ReaderEpoch;
+    
+    /** Serializes writers */
+    mutable FCriticalSection WriterLock;
+    
+    /** Name of this repository */
+    FName RepositoryName;
+    
+    /** Priority of this repository */
+    int32 Priority;
+    
+    /** Handle for the tag tree change delegate that refreshes the parent map */
+    FDelegateHandle TagTreeChangedHandle;
+    
+    /** Handle for the end of frame delegate that frees retired snapshots */
+    FDelegateHandle EndFrameHandle;
+};
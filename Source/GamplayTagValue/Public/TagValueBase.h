@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "GameplayTags.h"
+#include "TagValueTypes.h"
 #include "TagValueBase.generated.h"
 
 /**
@@ -25,13 +26,16 @@ struct GAMPLAYTAGVALUE_API FBaseTagValue
 	// Virtual function to identify the type
 	virtual FName GetValueType() const { return NAME_None; }
 
+	// Virtual function to identify the type without name comparisons
+	virtual ETagValueType GetValueTypeId() const { return ETagValueType::None; }
+
 	// Try to cast to a specific type
 	template<typename T>
-	const T TryCast() const
+	const T* TryCast() const
 	{
-		if (GetValueType() == T::StaticValueType())
+		if (GetValueTypeId() == T::StaticTypeId)
 		{
-			return static_cast<const T>(this);
+			return static_cast<const T*>(this);
 		}
 		return nullptr;
 	}
@@ -54,15 +58,23 @@ struct GAMPLAYTAGVALUE_API FBoolTagValue : public FBaseTagValue
 {
 	GENERATED_BODY()
 
+	/** The C++ type of the stored value */
+	using ValueType = bool;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Tag Values")
 	bool Value;
 
 	FBoolTagValue() : Value(false) {}
 	FBoolTagValue(bool InValue) : Value(InValue) {}
 
-	virtual FName GetValueType() const override { return FName("Bool"); }
+	/** Compile-time type id */
+	static constexpr ETagValueType StaticTypeId = ETagValueType::Bool;
+
+	virtual FName GetValueType() const override { return StaticValueType(); }
+
+	virtual ETagValueType GetValueTypeId() const override { return StaticTypeId; }
 
-	static FName StaticValueType() { return FName("Bool"); }
+	static FName StaticValueType() { static const FName TypeName(TEXT("Bool")); return TypeName; }
 };
 
 /**
@@ -73,15 +85,23 @@ struct GAMPLAYTAGVALUE_API FIntTagValue : public FBaseTagValue
 {
 	GENERATED_BODY()
 
+	/** The C++ type of the stored value */
+	using ValueType = int32;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Tag Values")
 	int32 Value;
 
 	FIntTagValue() : Value(0) {}
 	FIntTagValue(int32 InValue) : Value(InValue) {}
 
-	virtual FName GetValueType() const override { return FName("Int"); }
+	/** Compile-time type id */
+	static constexpr ETagValueType StaticTypeId = ETagValueType::Int;
+
+	virtual FName GetValueType() const override { return StaticValueType(); }
+
+	virtual ETagValueType GetValueTypeId() const override { return StaticTypeId; }
 
-	static FName StaticValueType() { return FName("Int"); }
+	static FName StaticValueType() { static const FName TypeName(TEXT("Int")); return TypeName; }
 };
 
 /**
@@ -92,15 +112,23 @@ struct GAMPLAYTAGVALUE_API FFloatTagValue : public FBaseTagValue
 {
 	GENERATED_BODY()
 
+	/** The C++ type of the stored value */
+	using ValueType = float;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Tag Values")
 	float Value;
 
 	FFloatTagValue() : Value(0.0f) {}
 	FFloatTagValue(float InValue) : Value(InValue) {}
 
-	virtual FName GetValueType() const override { return FName("Float"); }
+	/** Compile-time type id */
+	static constexpr ETagValueType StaticTypeId = ETagValueType::Float;
+
+	virtual FName GetValueType() const override { return StaticValueType(); }
+
+	virtual ETagValueType GetValueTypeId() const override { return StaticTypeId; }
 
-	static FName StaticValueType() { return FName("Float"); }
+	static FName StaticValueType() { static const FName TypeName(TEXT("Float")); return TypeName; }
 };
 
 /**
@@ -111,15 +139,23 @@ struct GAMPLAYTAGVALUE_API FTransformTagValue : public FBaseTagValue
 {
 	GENERATED_BODY()
 
+	/** The C++ type of the stored value */
+	using ValueType = FTransform;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Tag Values")
 	FTransform Value;
 
 	FTransformTagValue() : Value(FTransform::Identity) {}
 	FTransformTagValue(const FTransform& InValue) : Value(InValue) {}
 
-	virtual FName GetValueType() const override { return FName("Transform"); }
+	/** Compile-time type id */
+	static constexpr ETagValueType StaticTypeId = ETagValueType::Transform;
+
+	virtual FName GetValueType() const override { return StaticValueType(); }
+
+	virtual ETagValueType GetValueTypeId() const override { return StaticTypeId; }
 
-	static FName StaticValueType() { return FName("Transform"); }
+	static FName StaticValueType() { static const FName TypeName(TEXT("Transform")); return TypeName; }
 };
 
 /**
@@ -130,15 +166,23 @@ struct GAMPLAYTAGVALUE_API FClassTagValue : public FBaseTagValue
 {
 	GENERATED_BODY()
 
+	/** The C++ type of the stored value */
+	using ValueType = TSoftClassPtr<UObject>;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Tag Values")
 	TSoftClassPtr<UObject> Value;
 
 	FClassTagValue() {}
 	FClassTagValue(const TSoftClassPtr<UObject>& InValue) : Value(InValue) {}
 
-	virtual FName GetValueType() const override { return FName("Class"); }
+	/** Compile-time type id */
+	static constexpr ETagValueType StaticTypeId = ETagValueType::Class;
+
+	virtual FName GetValueType() const override { return StaticValueType(); }
+
+	virtual ETagValueType GetValueTypeId() const override { return StaticTypeId; }
 
-	static FName StaticValueType() { return FName("Class"); }
+	static FName StaticValueType() { static const FName TypeName(TEXT("Class")); return TypeName; }
 };
 
 /**
@@ -149,15 +193,23 @@ struct GAMPLAYTAGVALUE_API FObjectTagValue : public FBaseTagValue
 {
 	GENERATED_BODY()
 
+	/** The C++ type of the stored value */
+	using ValueType = TSoftObjectPtr<UObject>;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Tag Values")
 	TSoftObjectPtr<UObject> Value;
 
 	FObjectTagValue() {}
 	FObjectTagValue(const TSoftObjectPtr<UObject>& InValue) : Value(InValue) {}
 
-	virtual FName GetValueType() const override { return FName("Object"); }
+	/** Compile-time type id */
+	static constexpr ETagValueType StaticTypeId = ETagValueType::Object;
+
+	virtual FName GetValueType() const override { return StaticValueType(); }
+
+	virtual ETagValueType GetValueTypeId() const override { return StaticTypeId; }
 
-	static FName StaticValueType() { return FName("Object"); }
+	static FName StaticValueType() { static const FName TypeName(TEXT("Object")); return TypeName; }
 };
 
 /**
@@ -168,13 +220,34 @@ struct GAMPLAYTAGVALUE_API FStringTagValue : public FBaseTagValue
 {
 	GENERATED_BODY()
 
+	/** The C++ type of the stored value */
+	using ValueType = FString;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Tag Values")
 	FString Value;
 
 	FStringTagValue() {}
 	FStringTagValue(const FString& InValue) : Value(InValue) {}
 
-	virtual FName GetValueType() const override { return FName("String"); }
+	/** Compile-time type id */
+	static constexpr ETagValueType StaticTypeId = ETagValueType::String;
+
+	virtual FName GetValueType() const override { return StaticValueType(); }
+
+	virtual ETagValueType GetValueTypeId() const override { return StaticTypeId; }
 
-	static FName StaticValueType() { return FName("String"); }
+	static FName StaticValueType() { static const FName TypeName(TEXT("String")); return TypeName; }
 };
+
+/**
+ * Compile-time mapping from a value's C++ type to its ETagValueType and tag value struct
+ */
+template<typename T> struct TTagValueTraits;
+
+template<> struct TTagValueTraits<bool> { using TagValueType = FBoolTagValue; static constexpr ETagValueType Type = ETagValueType::Bool; };
+template<> struct TTagValueTraits<int32> { using TagValueType = FIntTagValue; static constexpr ETagValueType Type = ETagValueType::Int; };
+template<> struct TTagValueTraits<float> { using TagValueType = FFloatTagValue; static constexpr ETagValueType Type = ETagValueType::Float; };
+template<> struct TTagValueTraits<FString> { using TagValueType = FStringTagValue; static constexpr ETagValueType Type = ETagValueType::String; };
+template<> struct TTagValueTraits<FTransform> { using TagValueType = FTransformTagValue; static constexpr ETagValueType Type = ETagValueType::Transform; };
+template<> struct TTagValueTraits<TSoftClassPtr<UObject>> { using TagValueType = FClassTagValue; static constexpr ETagValueType Type = ETagValueType::Class; };
+template<> struct TTagValueTraits<TSoftObjectPtr<UObject>> { using TagValueType = FObjectTagValue; static constexpr ETagValueType Type = ETagValueType::Object; };
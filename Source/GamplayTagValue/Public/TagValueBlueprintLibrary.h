@@ -106,4 +106,8 @@ public:
 	/** Clear all values from the container */
 	UFUNCTION(BlueprintCallable, Category = "TagValue")
 	static void ClearTagValues(UPARAM(ref) FTagValueContainer& Container);
+
+	/** Replace every value in the container */
+	UFUNCTION(BlueprintCallable, Category = "TagValue")
+	static void SetTagValues(UPARAM(ref) FTagValueContainer& Container, const TArray<FInstancedStruct>& Values);
 };
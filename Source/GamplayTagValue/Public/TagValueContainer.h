@@ -5,21 +5,30 @@
 #include "CoreMinimal.h"
 #include "GameplayTags.h"
 #include "TagValueBase.h"
+#include "StructUtils/InstancedStruct.h"
 #include "Templates/SharedPointer.h"
 #include "TagValueContainer.generated.h"
 
 /**
  * Container for storing and retrieving tag values of different types
  * Provides type-safe access to various data types within the same container
+ * Values are stored as instanced structs so the derived value type survives copies and serialization.
+ * Lookups go through a lazily built tag -> index map; the container still serializes as the plain Values array.
+ * Hits and misses both cost one map probe, so edits made to Values in place must invalidate the index:
+ * loading and undo go through PostSerialize, owners call InvalidateTagIndex() after details panel edits,
+ * and Blueprint only changes Values through setters.
  */
 USTRUCT(BlueprintType)
 struct GAMPLAYTAGVALUE_API FTagValueContainer
 {
 	GENERATED_BODY()
 
-	/** Array of tag-value pairs */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Tag Value")
-	TArray<FBaseTagValue> Values;
+	/**
+	 * Array of tag-value pairs
+	 * Call InvalidateTagIndex() after modifying this array directly; Blueprint replaces it through UTagValueBlueprintLibrary::SetTagValues
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Tag Value", meta=(BaseStruct="/Script/GamplayTagValue.BaseTagValue", ExcludeBaseStruct))
+	TArray<FInstancedStruct> Values;
 
 	/** Default constructor */
 	FTagValueContainer() {}
@@ -32,26 +41,69 @@ struct GAMPLAYTAGVALUE_API FTagValueContainer
 	template<typename T>
 	void SetValue(FGameplayTag Tag, const T& Value)
 	{
-		// First remove any existing value with this tag
-		RemoveValue(Tag);
-		
 		// Create a new value of the appropriate type
 		T NewValue(Value);
 		NewValue.Tag = Tag;
-		Values.Add(NewValue);
-	}
 
-	const FBaseTagValue FindValue(FGameplayTag& Tag)
-	{
-		for (const FBaseTagValue& Value : Values)
+		// Replace an existing value in place, or append a new one
+		const int32 Index = FindIndex(Tag);
+		if (Index != INDEX_NONE)
 		{
-			if (Value.Tag == Tag)
+			if (Values[Index].GetScriptStruct() == T::StaticStruct())
+			{
+				Values[Index].GetMutable<T>() = MoveTemp(NewValue);
+			}
+			else
 			{
-				return Value;
+				Values[Index].InitializeAs<T>(MoveTemp(NewValue));
 			}
 		}
-		return FBaseTagValue();
+		else
+		{
+			const int32 NewIndex = Values.Add(FInstancedStruct::Make<T>(MoveTemp(NewValue)));
+			TagIndex.Add(Tag, NewIndex);
+			IndexedNum = Values.Num();
+		}
+	}
+
+	/**
+	 * Set an already instanced value for a gameplay tag
+	 * @param Tag - The gameplay tag to set the value for
+	 * @param Value - Instanced struct holding an FBaseTagValue-derived value
+	 */
+	void SetInstancedValue(FGameplayTag Tag, FInstancedStruct&& Value)
+	{
+		FBaseTagValue* NewValue = Value.GetMutablePtr<FBaseTagValue>();
+		if (!NewValue)
+		{
+			return;
+		}
+		NewValue->Tag = Tag;
+
+		const int32 Index = FindIndex(Tag);
+		if (Index != INDEX_NONE)
+		{
+			Values[Index] = MoveTemp(Value);
+		}
+		else
+		{
+			const int32 NewIndex = Values.Add(MoveTemp(Value));
+			TagIndex.Add(Tag, NewIndex);
+			IndexedNum = Values.Num();
+		}
+	}
+
+	/**
+	 * Find the value stored for a gameplay tag
+	 * @param Tag - The gameplay tag to look up
+	 * @return The stored value, or nullptr if there is none
+	 */
+	const FBaseTagValue* FindValue(FGameplayTag Tag) const
+	{
+		const int32 Index = FindIndex(Tag);
+		return Index != INDEX_NONE ? GetEntry(Values[Index]) : nullptr;
 	}
+
 	/**
 	 * Get a value of a specific type for a gameplay tag
 	 * @param Tag - The gameplay tag to get the value for
@@ -61,15 +113,12 @@ struct GAMPLAYTAGVALUE_API FTagValueContainer
 	template<typename T>
 	bool GetValue(FGameplayTag Tag, T& OutValue) const
 	{
-		for (const FBaseTagValue& Value : Values)
+		if (const FBaseTagValue* Value = FindValue(Tag))
 		{
-			if (Value.Tag == Tag)
+			if (const T* TypedValue = Value->TryCast<T>())
 			{
-				if (const T* TypedValue = Value.TryCast<T>())
-				{
-					OutValue = *TypedValue;
-					return true;
-				}
+				OutValue = *TypedValue;
+				return true;
 			}
 		}
 		return false;
@@ -82,32 +131,36 @@ struct GAMPLAYTAGVALUE_API FTagValueContainer
 	 */
 	bool HasValue(FGameplayTag Tag) const
 	{
-		for (const FBaseTagValue& Value : Values)
-		{
-			if (Value.Tag == Tag)
-			{
-				return true;
-			}
-		}
-		return false;
+		return FindIndex(Tag) != INDEX_NONE;
 	}
 
 	/**
 	 * Remove a value for a gameplay tag
+	 * The last value is moved into the freed slot, so the order of Values is not preserved
 	 * @param Tag - The gameplay tag to remove the value for
 	 * @return True if a value was removed
 	 */
 	bool RemoveValue(FGameplayTag Tag)
 	{
-		for (int32 i = 0; i < Values.Num(); i++)
+		const int32 Index = FindIndex(Tag);
+		if (Index == INDEX_NONE)
+		{
+			return false;
+		}
+
+		TagIndex.Remove(Tag);
+		Values.RemoveAtSwap(Index);
+		IndexedNum = Values.Num();
+
+		// Patch the index of the value that moved into the freed slot
+		if (Values.IsValidIndex(Index))
 		{
-			if (Values[i].Tag == Tag)
+			if (const FBaseTagValue* Moved = GetEntry(Values[Index]))
 			{
-				Values.RemoveAt(i);
-				return true;
+				TagIndex.Add(Moved->Tag, Index);
 			}
 		}
-		return false;
+		return true;
 	}
 
 	/**
@@ -117,9 +170,13 @@ struct GAMPLAYTAGVALUE_API FTagValueContainer
 	TArray<FGameplayTag> GetAllTags() const
 	{
 		TArray<FGameplayTag> Tags;
-		for (const FBaseTagValue& Value : Values)
+		Tags.Reserve(Values.Num());
+		for (const FInstancedStruct& Value : Values)
 		{
-			Tags.Add(Value.Tag);
+			if (const FBaseTagValue* Entry = GetEntry(Value))
+			{
+				Tags.Add(Entry->Tag);
+			}
 		}
 		return Tags;
 	}
@@ -130,6 +187,8 @@ struct GAMPLAYTAGVALUE_API FTagValueContainer
 	void Clear()
 	{
 		Values.Empty();
+		TagIndex.Empty();
+		IndexedNum = 0;
 	}
 
 	/**
@@ -140,4 +199,85 @@ struct GAMPLAYTAGVALUE_API FTagValueContainer
 	{
 		return Values.Num();
 	}
+
+	/**
+	 * Discard the tag index so it is rebuilt on the next lookup
+	 * Needed after modifying Values directly
+	 */
+	void InvalidateTagIndex() const
+	{
+		IndexedNum = INDEX_NONE;
+	}
+
+	/** Invalidate the tag index after Values was loaded, including by undo and redo */
+	void PostSerialize(const FArchive& Ar)
+	{
+		if (Ar.IsLoading())
+		{
+			InvalidateTagIndex();
+		}
+	}
+
+private:
+	/** Get the tag value held by an entry, or nullptr for an empty entry */
+	static const FBaseTagValue* GetEntry(const FInstancedStruct& Value)
+	{
+		return Value.GetPtr<FBaseTagValue>();
+	}
+
+	/** Find the array index of a tag's value, rebuilding the tag index if it is stale */
+	int32 FindIndex(const FGameplayTag& Tag) const
+	{
+		if (IndexedNum != Values.Num())
+		{
+			RebuildTagIndex();
+		}
+
+		const int32* Index = TagIndex.Find(Tag);
+		if (!Index)
+		{
+			return INDEX_NONE;
+		}
+
+		// Guard against Values having been edited behind the index's back
+		const FBaseTagValue* Entry = Values.IsValidIndex(*Index) ? GetEntry(Values[*Index]) : nullptr;
+		if (!Entry || Entry->Tag != Tag)
+		{
+			RebuildTagIndex();
+			Index = TagIndex.Find(Tag);
+			return Index ? *Index : INDEX_NONE;
+		}
+		return *Index;
+	}
+
+	/** Rebuild the tag index from Values; the first value wins for duplicated tags */
+	void RebuildTagIndex() const
+	{
+		TagIndex.Reset();
+		TagIndex.Reserve(Values.Num());
+		for (int32 Index = 0; Index < Values.Num(); ++Index)
+		{
+			const FBaseTagValue* Entry = GetEntry(Values[Index]);
+			if (Entry && !TagIndex.Contains(Entry->Tag))
+			{
+				TagIndex.Add(Entry->Tag, Index);
+			}
+		}
+		IndexedNum = Values.Num();
+	}
+
+	/** Tag -> index into Values, built lazily and not serialized */
+	mutable TMap<FGameplayTag, int32> TagIndex;
+
+	/** Number of values covered by TagIndex, or INDEX_NONE if the index must be rebuilt */
+	mutable int32 IndexedNum = INDEX_NONE;
+};
+
+template<>
+struct TStructOpsTypeTraits<FTagValueContainer> : public TStructOpsTypeTraitsBase2<FTagValueContainer>
+{
+	enum
+	{
+		WithPostSerialize = true,
+	};
 };
@@ -0,0 +1,139 @@
+// Copyright 2025 Nguyen Phi Hung. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTags.h"
+#include "GameplayTagValueSubsystem.h"
+#include "TagValueBase.h"
+#include "TagValueInterface.h"
+#include "TagValueVariant.h"
+
+/**
+ * Records what a cached tag resolution depends on
+ * A resolution stays valid while the repository layout is unchanged and none of the repositories
+ * that could affect it (those checked before and including the one that provided the value) were written to.
+ */
+struct GAMPLAYTAGVALUE_API FTagValueHandleBinding
+{
+    /** Repository layout generation of the subsystem when the binding was made */
+    uint32 LayoutGeneration = 0;
+    
+    /** Repositories the resolution depends on, with their generation at binding time */
+    FTagValueRepositoryDependencies Dependencies;
+    
+    /** Whether the binding has been made at all */
+    bool bBound = false;
+    
+    /**
+     * Check that a resolution made with this binding is still up to date
+     * @param Subsystem The subsystem the binding was made against
+     * @return True if no dependency changed
+     */
+    bool IsCurrent(const UGameplayTagValueSubsystem& Subsystem) const
+    {
+        // The layout check comes first: dependencies may have been unregistered, or destroyed by Deinitialize, since
+        return bBound && LayoutGeneration == Subsystem.GetRepositoryLayoutGeneration() && Dependencies.IsCurrent();
+    }
+    
+    /** Forget the binding so the next read resolves again */
+    void Reset()
+    {
+        Dependencies.Reset();
+        bBound = false;
+    }
+};
+
+/**
+ * Typed handle to the value of a single tag, for code that reads the same tags every frame
+ * The tag is resolved once; later reads validate the binding with a few loads and compares and
+ * return the cached value. The handle resolves again only when a repository the value depends on
+ * was written to, or repositories were registered, unregistered or reordered.
+ * Context objects are not consulted, as with UGameplayTagValueSubsystem::TryGetRaw.
+ *
+ * Example:
+ *   TTagValueHandle<float> MaxSpeed(Subsystem, TAG_Movement_MaxSpeed);
+ *   const float Speed = MaxSpeed.Get(600.0f);
+ */
+template<typename T>
+class TTagValueHandle
+{
+public:
+    TTagValueHandle() = default;
+    
+    TTagValueHandle(const UGameplayTagValueSubsystem* InSubsystem, FGameplayTag InTag)
+        : Subsystem(InSubsystem)
+        , Tag(InTag)
+    {
+    }
+    
+    /**
+     * Read the value
+     * @param OutValue Receives the value if the tag resolves to a value of type T
+     * @return True if a value was found
+     */
+    bool TryGet(T& OutValue) const
+    {
+        if (!Refresh() || !bHasValue)
+        {
+            return false;
+        }
+        OutValue = CachedValue;
+        return true;
+    }
+    
+    /**
+     * Read the value
+     * @param DefaultValue The value to return if the tag has no value of type T
+     * @return The value, or DefaultValue
+     */
+    T Get(const T& DefaultValue = T()) const
+    {
+        return Refresh() && bHasValue ? CachedValue : DefaultValue;
+    }
+    
+    /** Force the next read to resolve the tag again */
+    void Invalidate()
+    {
+        Binding.Reset();
+    }
+    
+    /** @return The tag this handle reads */
+    const FGameplayTag& GetTag() const { return Tag; }
+    
+    /** @return True if the handle points at a live subsystem and a valid tag */
+    bool IsValid() const { return Subsystem.IsValid() && Tag.IsValid(); }
+
+private:
+    /** Resolve the tag again if the binding is out of date; returns false if the subsystem is gone */
+    bool Refresh() const
+    {
+        const UGameplayTagValueSubsystem* Resolver = Subsystem.Get();
+        if (!Resolver)
+        {
+            return false;
+        }
+        
+        if (!Binding.IsCurrent(*Resolver))
+        {
+            FTagValueVariant Value;
+            bHasValue = Resolver->BindTagValueHandle(Tag, Value, Binding) && Value.TryGet(CachedValue);
+        }
+        return true;
+    }
+    
+    /** The subsystem the value is resolved through */
+    TWeakObjectPtr<const UGameplayTagValueSubsystem> Subsystem;
+    
+    /** The tag to read */
+    FGameplayTag Tag;
+    
+    /** What the cached value depends on */
+    mutable FTagValueHandleBinding Binding;
+    
+    /** The value at the last resolution */
+    mutable T CachedValue = T();
+    
+    /** Whether the last resolution found a value of type T */
+    mutable bool bHasValue = false;
+};
@@ -7,8 +7,13 @@
 #include "GameplayTags.h"
 #include "TagValueBase.h"
 #include "TagValueContainer.h"
+#include "TagValueTagIndex.h"
+#include "TagValueTypes.h"
+#include <atomic>
+#include <type_traits>
 #include "TagValueInterface.generated.h"
 
+class FTagValueVariant;
 
 /**
  * Interface for the type erasure pattern that holds different value types
@@ -26,6 +31,13 @@ public:
     /** Get the name of the value type */
     virtual FName GetValueTypeName() const = 0;
     
+    /**
+     * Get the type id of the value, for switch-based dispatch
+     * The default implementation maps GetValueTypeName() to one of the built-in value structs, so holders
+     * that predate type ids keep working; it returns ETagValueType::None for any other type.
+     */
+    virtual ETagValueType GetValueTypeId() const;
+    
     /** Create a copy of this value holder */
     virtual TSharedPtr<ITagValueHolder> Clone() const = 0;
     
@@ -33,14 +45,32 @@ public:
     virtual bool IsValid() const = 0;
 };
 
+/** Compile-time type id of a value struct, or ETagValueType::None if it does not declare StaticTypeId */
+template<typename T, typename = void>
+struct TTagValueStaticTypeId
+{
+    static constexpr ETagValueType Value = ETagValueType::None;
+};
+
+template<typename T>
+struct TTagValueStaticTypeId<T, std::void_t<decltype(T::StaticTypeId)>>
+{
+    static constexpr ETagValueType Value = T::StaticTypeId;
+};
+
 /**
  * Template implementation of ITagValueHolder for specific types
  * Provides type-safe access to the contained value
+ * T is usually one of the FBaseTagValue-derived structs (FBoolTagValue, FFloatTagValue, ...);
+ * other structs get their type id from the type name, as holders without a type id do
  */
 template<typename T>
 class GAMPLAYTAGVALUE_API TTagValueHolder : public ITagValueHolder
 {
 public:
+    /** Compile-time type id of the held value, or None if T does not declare one */
+    static constexpr ETagValueType StaticTypeId = TTagValueStaticTypeId<T>::Value;
+    
     TTagValueHolder(const T& InValue) : Value(InValue) {}
     
     /** Get a pointer to the raw value */
@@ -49,6 +79,19 @@ public:
     /** Get the name of the value type */
     virtual FName GetValueTypeName() const override { return TBaseStructure<T>::Get()->GetFName(); }
     
+    /** Get the type id of the value */
+    virtual ETagValueType GetValueTypeId() const override
+    {
+        if constexpr (StaticTypeId != ETagValueType::None)
+        {
+            return StaticTypeId;
+        }
+        else
+        {
+            return ITagValueHolder::GetValueTypeId();
+        }
+    }
+    
     /** Create a copy of this value holder */
     virtual TSharedPtr<ITagValueHolder> Clone() const override
     {
@@ -66,6 +109,10 @@ public:
  * Repository interface for storing and retrieving tag values
  * Different implementations can store values in different backends
  * (memory, data tables, save games, etc.)
+ *
+ * Every mutation must call BumpGeneration(). The subsystem caches resolved values against the
+ * generations of the repositories they depend on, so a write that does not bump the generation
+ * stays invisible to cached reads until the repository layout changes.
  */
 class GAMPLAYTAGVALUE_API ITagValueRepository
 {
@@ -78,6 +125,26 @@ public:
     /** Get the value for the given tag */
     virtual TSharedPtr<ITagValueHolder> GetValue(FGameplayTag Tag) const = 0;
     
+    /**
+     * Get the value for the given tag without going through a shared holder
+     * The default implementation wraps GetValue(); repositories should override it with a non-allocating lookup.
+     * @param Tag The tag to get the value for
+     * @param OutValue Receives the value if found
+     * @return True if a value exists for the tag
+     */
+    virtual bool TryGetRaw(FGameplayTag Tag, FTagValueVariant& OutValue) const;
+    
+    /**
+     * Get the value for a tag whose dense index the caller already knows
+     * Repositories addressed by dense index override this to skip looking the index up again;
+     * the index may be stale, so they still check the tag stored at it. The default implementation ignores the index.
+     * @param Tag The tag to get the value for
+     * @param TagIndex The tag's dense index (see FTagValueTagIndex and FTagValueIndexedTag), or INDEX_NONE if unknown
+     * @param OutValue Receives the value if found
+     * @return True if a value exists for the tag
+     */
+    virtual bool TryGetRawAt(FGameplayTag Tag, int32 TagIndex, FTagValueVariant& OutValue) const;
+    
     /** Set the value for the given tag */
     virtual void SetValue(FGameplayTag Tag, TSharedPtr<ITagValueHolder> Value) = 0;
     
@@ -87,6 +154,14 @@ public:
     /** Clear all values in this repository */
     virtual void ClearAllValues() = 0;
     
+    /**
+     * Clear all values in this repository and hand them over, so they can still be read after the clear
+     * The default implementation copies the values into a memory repository and then clears;
+     * repositories that can give their storage away in constant time should override it.
+     * @return A repository holding the values this one held before the clear
+     */
+    virtual TSharedPtr<ITagValueRepository> DetachAllValues();
+    
     /** Get all tags in this repository */
     virtual TArray<FGameplayTag> GetAllTags() const = 0;
     
@@ -95,6 +170,107 @@ public:
     
     /** Get the priority of this repository (higher priority repositories are checked first) */
     virtual int32 GetPriority() const = 0;
+    
+    /** Get the generation of this repository, bumped on every mutation; safe to call from any thread */
+    uint32 GetGeneration() const { return Generation.load(std::memory_order_acquire); }
+    
+    /**
+     * Get the membership filter of this repository
+     * Lookups consult it before probing the repository, to skip tags and subtrees it holds no values for.
+     * @return The filter, or nullptr if the repository does not maintain one
+     */
+    const FTagValueMembershipFilter* GetMembershipFilter() const { return MembershipFilter.Get(); }
+    
+protected:
+    /** Start maintaining a membership filter; implementations that do must report every change through the calls below */
+    void EnableMembershipFilter()
+    {
+        if (!MembershipFilter.IsValid())
+        {
+            MembershipFilter = MakeUnique<FTagValueMembershipFilter>();
+            MembershipFilter->Rebuild(GetAllTags());
+        }
+    }
+    
+    /** Record in the membership filter that a tag now has a value */
+    void MarkTagPresent(const FGameplayTag& Tag);
+    
+    /** Record in the membership filter that a tag no longer has a value */
+    void MarkTagAbsent(const FGameplayTag& Tag);
+    
+    /** Give the membership filter to the repository the recorded values were moved to, and start an empty one */
+    void HandOverMembership(ITagValueRepository& Target)
+    {
+        if (MembershipFilter.IsValid())
+        {
+            Target.MembershipFilter = MoveTemp(MembershipFilter);
+            EnableMembershipFilter();
+        }
+    }
+    
+    /** Record in the membership filter that the repository is empty */
+    void ResetMembership()
+    {
+        if (MembershipFilter.IsValid())
+        {
+            MembershipFilter->Reset();
+        }
+    }
+    
+    /**
+     * Mark the repository contents as changed; implementations must call this from every mutation
+     * The increment is atomic, so writers on different threads may call it concurrently without a lock.
+     */
+    void BumpGeneration()
+    {
+        Generation.fetch_add(1, std::memory_order_release);
+    }
+    
+private:
+    /** Monotonic mutation counter */
+    std::atomic<uint32> Generation = 0;
+    
+    /** Optional record of the tags that have a value */
+    TUniquePtr<FTagValueMembershipFilter> MembershipFilter;
+};
+
+/**
+ * Repositories a resolved value depends on, each with its generation when the value was resolved
+ * The value stays current while none of them has been written to since.
+ */
+struct FTagValueRepositoryDependencies
+{
+    /** The repositories and their recorded generations */
+    TArray<TPair<const ITagValueRepository*, uint32>, TInlineAllocator<4>> Repositories;
+    
+    /** Record a repository at its current generation */
+    void Add(const ITagValueRepository& Repository)
+    {
+        Repositories.Emplace(&Repository, Repository.GetGeneration());
+    }
+    
+    /**
+     * Check that no recorded repository changed
+     * The repositories must still be alive; owners drop their dependencies when the layout changes.
+     * @return True if every generation still matches
+     */
+    bool IsCurrent() const
+    {
+        for (const TPair<const ITagValueRepository*, uint32>& Dependency : Repositories)
+        {
+            if (Dependency.Key->GetGeneration() != Dependency.Value)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+    
+    /** Forget every recorded repository */
+    void Reset()
+    {
+        Repositories.Reset();
+    }
 };
 
 /**
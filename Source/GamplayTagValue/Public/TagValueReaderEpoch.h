@@ -0,0 +1,105 @@
+// Copyright 2025 Nguyen Phi Hung. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+/**
+ * Deferred reclamation for repositories whose readers never lock
+ * Readers open an FReadScope, which enters one of two counters picked by the current epoch. Writers
+ * retire whatever they unlink, advance the epoch, and free a batch once the counter of the epoch it
+ * was retired in drains. A reader that stalls for any length of time therefore never sees freed memory,
+ * and readers only ever wait for each other's counter increments, never for a writer.
+ *
+ * Owners that reuse two buffers instead of freeing memory skip Retire and Reclaim: readers use the buffer
+ * matching the parity of the epoch they entered, and the writer only touches the other buffer once
+ * HasPreviousEpochReaders reports it empty, then Advances to publish it.
+ *
+ * Retire, Reclaim and Advance must be serialized by the owner's writer lock; FReadScope is safe on any thread.
+ */
+class GAMPLAYTAGVALUE_API FTagValueReaderEpoch
+{
+    /** Number of readers that entered during epochs of one parity, on its own cache line */
+    struct alignas(PLATFORM_CACHE_LINE_SIZE) FReaderCount
+    {
+        std::atomic<int32> Num{ 0 };
+    };
+    
+public:
+    FTagValueReaderEpoch() = default;
+    
+    UE_NONCOPYABLE(FTagValueReaderEpoch);
+    
+    /** Counts the calling thread as a reader for its lifetime; anything it loads meanwhile stays alive */
+    class GAMPLAYTAGVALUE_API FReadScope
+    {
+    public:
+        explicit FReadScope(const FTagValueReaderEpoch& Epoch);
+        ~FReadScope();
+        
+        UE_NONCOPYABLE(FReadScope);
+        
+        /** @return The epoch this reader entered in */
+        uint32 GetEpoch() const { return EnteredEpoch; }
+        
+    private:
+        /** The counter this reader incremented */
+        FReaderCount* Count;
+        
+        /** The epoch this reader entered in */
+        uint32 EnteredEpoch;
+    };
+    
+    /**
+     * Keep something a writer has just unlinked alive until no reader can still be using it
+     * @param Item Owner of the unlinked memory, e.g. a TUniquePtr or TSharedPtr; destroyed once reclaimed
+     */
+    template<typename ItemType>
+    void Retire(ItemType Item)
+    {
+        Retired.Add(MakeUnique<TRetired<ItemType>>(MoveTemp(Item)));
+    }
+    
+    /**
+     * Free what readers of the previous epoch have finished with, and advance the epoch if more is waiting
+     * Writers call this after every write; it never waits for readers.
+     */
+    void Reclaim();
+    
+    /** @return The current epoch, as seen by the owner's writer */
+    uint32 GetEpoch() const { return Epoch.load(std::memory_order_relaxed); }
+    
+    /** @return True if a reader that entered before the epoch was last advanced has not left yet */
+    bool HasPreviousEpochReaders() const;
+    
+    /** Advance the epoch without retiring anything; readers entering from now on count toward the new epoch */
+    void Advance();
+    
+private:
+    /** Type-erased owner of a retired item */
+    struct FRetiredBase
+    {
+        virtual ~FRetiredBase() = default;
+    };
+    
+    template<typename ItemType>
+    struct TRetired : FRetiredBase
+    {
+        explicit TRetired(ItemType&& InItem) : Item(MoveTemp(InItem)) {}
+        
+        ItemType Item;
+    };
+    
+    /** Items retired since the epoch was last advanced */
+    TArray<TUniquePtr<FRetiredBase>> Retired;
+    
+    /** Items retired before the epoch was last advanced, freed once the readers of that epoch leave */
+    TArray<TUniquePtr<FRetiredBase>> Draining;
+    
+    /** Advanced by writers when they have retired items to free */
+    std::atomic<uint32> Epoch{ 0 };
+    
+    /** Readers currently inside even and odd epochs */
+    mutable FReaderCount ReaderCounts[2];
+};
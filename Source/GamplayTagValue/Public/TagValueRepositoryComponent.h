@@ -29,6 +29,13 @@ public:
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	// End UActorComponent interface
 
+#if WITH_EDITOR
+	// Begin UObject interface
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+	virtual void PostEditUndo() override;
+	// End UObject interface
+#endif
+
 	// Begin ITagValueRepository interface
 	virtual bool HasValue(FGameplayTag Tag) const override;
 	virtual TSharedPtr<ITagValueHolder> GetValue(FGameplayTag Tag) const override;
@@ -129,8 +136,8 @@ public:
 	void UnregisterFromSubsystem();
 
 protected:
-	/** The tag value container storing all values */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gameplay Tags|Values")
+	/** The tag value container storing all values; Blueprint writes go through the setters so every change bumps the generation */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Gameplay Tags|Values")
 	FTagValueContainer TagValueContainer;
 
 	/** Whether to automatically register with the subsystem on BeginPlay */
@@ -150,7 +157,7 @@ private:
 	TSharedPtr<ITagValueHolder> ConvertTagValueToHolder(const FBaseTagValue& Value) const;
 
 	/** Helper function to convert between ITagValueHolder and appropriate tag value type */
-	TSharedPtr<FBaseTagValue> ConvertHolderToTagValue(const TSharedPtr<ITagValueHolder>& Holder) const;
+	FInstancedStruct ConvertHolderToTagValue(const TSharedPtr<ITagValueHolder>& Holder) const;
 
 	/** Flag to track if we're registered with the subsystem */
 	bool bIsRegistered;
@@ -0,0 +1,267 @@
+// Copyright 2025 Nguyen Phi Hung. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTags.h"
+#include "TagValueTypes.h"
+#include "TagValueBase.h"
+#include "TagValueInterface.h"
+#include "TagValueTagIndex.h"
+#include "TagValueSubscription.generated.h"
+
+/**
+ * Describes a single tag value change as passed to subscribers
+ * The old and new values are non-owning views that are only valid for the duration of the callback.
+ */
+struct GAMPLAYTAGVALUE_API FTagValueChangeEvent
+{
+    /** The tag whose value changed */
+    FGameplayTag Tag;
+    
+    /** The repository where the change occurred */
+    FName RepositoryName;
+    
+    /** The value before the change, or nullptr if there was none */
+    ITagValueHolder* OldValue = nullptr;
+    
+    /** The value after the change, or nullptr if the value was removed */
+    ITagValueHolder* NewValue = nullptr;
+    
+    /** Type of the new value, or of the old value if the value was removed */
+    ETagValueType ValueType = ETagValueType::None;
+    
+    FTagValueChangeEvent() {}
+    FTagValueChangeEvent(FGameplayTag InTag, FName InRepositoryName, ITagValueHolder* InOldValue, ITagValueHolder* InNewValue)
+        : Tag(InTag)
+        , RepositoryName(InRepositoryName)
+        , OldValue(InOldValue)
+        , NewValue(InNewValue)
+        , ValueType(InNewValue ? InNewValue->GetValueTypeId() : InOldValue ? InOldValue->GetValueTypeId() : ETagValueType::None)
+    {
+    }
+    
+    /**
+     * Read the old value as a specific type
+     * @param OutValue Receives the value if it exists and is of type T
+     * @return True if the old value was read
+     */
+    template<typename T>
+    bool GetOldValue(T& OutValue) const { return ReadValue(OldValue, OutValue); }
+    
+    /**
+     * Read the new value as a specific type
+     * @param OutValue Receives the value if it exists and is of type T
+     * @return True if the new value was read
+     */
+    template<typename T>
+    bool GetNewValue(T& OutValue) const { return ReadValue(NewValue, OutValue); }
+    
+private:
+    template<typename T>
+    static bool ReadValue(ITagValueHolder* Holder, T& OutValue)
+    {
+        using TagValueType = typename TTagValueTraits<T>::TagValueType;
+        
+        if (!Holder || Holder->GetValueTypeId() != TTagValueTraits<T>::Type)
+        {
+            return false;
+        }
+        OutValue = static_cast<const TagValueType*>(Holder->GetValuePtr())->Value;
+        return true;
+    }
+};
+
+/**
+ * Native delegate for C++ subscribers to tag value changes
+ * @param Event The change that occurred
+ */
+DECLARE_DELEGATE_OneParam(FOnTagValueChangedNative, const FTagValueChangeEvent& /*Event*/);
+
+/**
+ * Native multicast event for C++ listeners to every tag value change
+ * @param Event The change that occurred
+ */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnTagValueChangedNativeEvent, const FTagValueChangeEvent& /*Event*/);
+
+/**
+ * Native delegate receiving the old and new value of a tag as a specific type
+ * The old value is default constructed if the tag had no value of type T before the change.
+ */
+template<typename T>
+using TOnTypedTagValueChanged = TDelegate<void(FGameplayTag /*Tag*/, const T& /*OldValue*/, const T& /*NewValue*/)>;
+
+using FOnBoolTagValueChanged = TOnTypedTagValueChanged<bool>;
+using FOnIntTagValueChanged = TOnTypedTagValueChanged<int32>;
+using FOnFloatTagValueChanged = TOnTypedTagValueChanged<float>;
+using FOnStringTagValueChanged = TOnTypedTagValueChanged<FString>;
+using FOnTransformTagValueChanged = TOnTypedTagValueChanged<FTransform>;
+
+/**
+ * Blueprint delegate for subscribers to tag value changes
+ * @param Tag The tag that changed
+ * @param RepositoryName The repository where the change occurred
+ */
+DECLARE_DYNAMIC_DELEGATE_TwoParams(FOnTagValueChangedDynamic, FGameplayTag, Tag, FName, RepositoryName);
+
+/**
+ * Handle identifying a tag value subscription, used to unsubscribe
+ */
+USTRUCT(BlueprintType)
+struct GAMPLAYTAGVALUE_API FTagValueSubscriptionHandle
+{
+    GENERATED_BODY()
+    
+    FTagValueSubscriptionHandle() {}
+    explicit FTagValueSubscriptionHandle(uint64 InId) : Id(InId) {}
+    
+    /** @return True if the handle refers to a subscription */
+    bool IsValid() const { return Id != 0; }
+    
+    /** Clear the handle */
+    void Reset() { Id = 0; }
+    
+    bool operator==(const FTagValueSubscriptionHandle& Other) const { return Id == Other.Id; }
+    bool operator!=(const FTagValueSubscriptionHandle& Other) const { return Id != Other.Id; }
+    
+    friend uint32 GetTypeHash(const FTagValueSubscriptionHandle& Handle) { return GetTypeHash(Handle.Id); }
+    
+private:
+    friend class FTagValueSubscriptionRegistry;
+    
+    uint64 Id = 0;
+};
+
+/**
+ * Registry of tag value subscriptions keyed by tag
+ * Dispatching a change only visits the subscribers of the changed tag and of its ancestors
+ * (for subscriptions that include descendants), instead of every listener.
+ * Subscribers may subscribe and unsubscribe from within a callback.
+ */
+class GAMPLAYTAGVALUE_API FTagValueSubscriptionRegistry
+{
+public:
+    /**
+     * Add a native subscription
+     * @param Tag The tag to subscribe to
+     * @param Scope Whether changes to descendants of the tag are included
+     * @param Delegate The delegate to call on change
+     * @return Handle for unsubscribing, invalid if the tag or delegate is invalid
+     */
+    FTagValueSubscriptionHandle Subscribe(FGameplayTag Tag, ETagValueSubscriptionScope Scope, FOnTagValueChangedNative Delegate);
+    
+    /**
+     * Add a Blueprint subscription
+     * @param Tag The tag to subscribe to
+     * @param Scope Whether changes to descendants of the tag are included
+     * @param Delegate The delegate to call on change
+     * @return Handle for unsubscribing, invalid if the tag or delegate is invalid
+     */
+    FTagValueSubscriptionHandle Subscribe(FGameplayTag Tag, ETagValueSubscriptionScope Scope, FOnTagValueChangedDynamic Delegate);
+    
+    /**
+     * Remove a subscription
+     * @param Handle The handle returned when subscribing
+     * @return True if the subscription existed
+     */
+    bool Unsubscribe(FTagValueSubscriptionHandle Handle);
+    
+    /**
+     * Call every subscriber that matches the changed tag
+     * @param Event The change to dispatch
+     */
+    void Dispatch(const FTagValueChangeEvent& Event);
+    
+    /**
+     * Call the subscribers of every tag a cleared repository held, with a removal for each
+     * Old values are looked up only for tags someone subscribed to; subtree subscriptions need every cleared tag checked.
+     * @param RepositoryName The repository that was cleared
+     * @param ClearedValues The values the repository held before the clear
+     */
+    void DispatchCleared(FName RepositoryName, const ITagValueRepository& ClearedValues);
+    
+    /**
+     * Check whether a change to a tag would reach any subscriber
+     * @param Tag The tag to check
+     * @return True if the tag or one of its ancestors has a matching subscription
+     */
+    bool HasSubscribers(FGameplayTag Tag) const;
+    
+    /** Remove all subscriptions */
+    void Reset();
+    
+    /** @return The number of active subscriptions */
+    int32 Num() const { return Locations.Num(); }
+    
+    /**
+     * Set how long a subscriber may take before it is reported as slow
+     * @param Seconds The threshold, or 0 to disable timing
+     */
+    void SetSlowSubscriberThreshold(double Seconds) { SlowSubscriberThreshold = Seconds; }
+    
+    /**
+     * Set the ancestor table used to find subtree subscribers of a changed tag
+     * @param InAncestorTable The table, which must outlive the registry, or nullptr to walk the tag manager
+     */
+    void SetAncestorTable(const FTagValueAncestorTable* InAncestorTable) { AncestorTable = InAncestorTable; }
+    
+private:
+    /** A single subscription */
+    struct FSubscriber
+    {
+        uint64 Id = 0;
+        FOnTagValueChangedNative NativeDelegate;
+        FOnTagValueChangedDynamic DynamicDelegate;
+        
+        void Execute(const FTagValueChangeEvent& Event) const;
+        
+        /** Describe the bound object and function, for diagnostics */
+        FString Describe() const;
+    };
+    
+    using FSubscriberMap = TMap<FGameplayTag, TArray<FSubscriber>>;
+    
+    /** Where a subscription is stored */
+    struct FLocation
+    {
+        FGameplayTag Tag;
+        ETagValueSubscriptionScope Scope = ETagValueSubscriptionScope::ExactTag;
+    };
+    
+    FTagValueSubscriptionHandle AddSubscriber(FGameplayTag Tag, ETagValueSubscriptionScope Scope, FSubscriber&& Subscriber);
+    FSubscriberMap& GetMap(ETagValueSubscriptionScope Scope);
+    
+    /** Call a function for the tag and each of its ancestors, stopping when it returns false */
+    template<typename FunctionType>
+    void ForEachAncestor(FGameplayTag Tag, FunctionType&& Function) const;
+    
+    void DispatchToSubscribers(const FSubscriberMap& Map, FGameplayTag Key, const FTagValueChangeEvent& Event);
+    void ApplyPendingChanges();
+    
+    /** Subscribers of exactly one tag */
+    FSubscriberMap ExactSubscribers;
+    
+    /** Subscribers of a tag and its descendants */
+    FSubscriberMap SubtreeSubscribers;
+    
+    /** Tag and scope of every subscription, by id */
+    TMap<uint64, FLocation> Locations;
+    
+    /** Subscriptions added during a dispatch, inserted once the dispatch finishes */
+    TArray<TPair<FLocation, FSubscriber>> PendingAdditions;
+    
+    /** Subscriptions removed during a dispatch, compacted once the dispatch finishes */
+    TArray<FLocation> PendingCompaction;
+    
+    /** Id given to the next subscription */
+    uint64 NextId = 1;
+    
+    /** Depth of nested Dispatch calls */
+    int32 DispatchDepth = 0;
+    
+    /** Subscribers taking longer than this many seconds are reported; 0 disables timing */
+    double SlowSubscriberThreshold = 0.0;
+    
+    /** Ancestor chains used for subtree matching, if available */
+    const FTagValueAncestorTable* AncestorTable = nullptr;
+};
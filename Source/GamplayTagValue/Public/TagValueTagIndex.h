@@ -0,0 +1,253 @@
+// Copyright 2025 Nguyen Phi Hung. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTags.h"
+
+/**
+ * Helpers for addressing gameplay tags by a dense integer index
+ * The index is the tag's network index from UGameplayTagsManager, which is
+ * contiguous over all registered tags and therefore usable as an array slot.
+ * Indices are only stable until the tag tree changes (see IGameplayTagsModule::OnGameplayTagTreeChanged).
+ */
+struct GAMPLAYTAGVALUE_API FTagValueTagIndex
+{
+    /**
+     * Get the dense index of a tag
+     * @param Tag The tag to look up
+     * @return The index, or INDEX_NONE if the tag is not registered
+     */
+    static int32 GetIndex(const FGameplayTag& Tag);
+    
+    /**
+     * Get the number of indices currently in use
+     * Every valid index is strictly less than this value
+     */
+    static int32 GetNumIndices();
+    
+    /**
+     * Get a counter that is bumped every time the tag tree changes
+     * Anything that stores dense indices can compare against it to detect that they are stale.
+     */
+    static uint32 GetTreeSerial();
+    
+    /** Bump the tree serial; bound to IGameplayTagsModule::OnGameplayTagTreeChanged by the module */
+    static void HandleTagTreeChanged();
+};
+
+/**
+ * A gameplay tag with its dense index looked up once
+ * FTagValueTagIndex::GetIndex goes through the tag manager's node map, so every lookup by tag
+ * pays a hash probe. Code that reads the same tags repeatedly keeps one of these and passes the
+ * index along (see ITagValueRepository::TryGetRawAt), which turns indexed lookups into an array
+ * access. The index is looked up again after the tag tree changes.
+ * The cached index is updated lazily, so an instance must not be shared between threads.
+ */
+struct GAMPLAYTAGVALUE_API FTagValueIndexedTag
+{
+    FTagValueIndexedTag() = default;
+    
+    explicit FTagValueIndexedTag(const FGameplayTag& InTag)
+        : Tag(InTag)
+        , Index(FTagValueTagIndex::GetIndex(InTag))
+        , TreeSerial(FTagValueTagIndex::GetTreeSerial())
+    {
+    }
+    
+    /** @return The tag */
+    const FGameplayTag& GetTag() const { return Tag; }
+    
+    /** @return The dense index of the tag, or INDEX_NONE if it is not registered */
+    int32 GetIndex() const
+    {
+        const uint32 CurrentSerial = FTagValueTagIndex::GetTreeSerial();
+        if (TreeSerial != CurrentSerial)
+        {
+            Index = FTagValueTagIndex::GetIndex(Tag);
+            TreeSerial = CurrentSerial;
+        }
+        return Index;
+    }
+
+private:
+    /** The tag */
+    FGameplayTag Tag;
+    
+    /** Dense index of the tag as of TreeSerial */
+    mutable int32 Index = INDEX_NONE;
+    
+    /** Tree serial the index was looked up against */
+    mutable uint32 TreeSerial = 0;
+};
+
+/**
+ * Flattened ancestor chains of every registered tag, addressed by the tag's dense index
+ * Hierarchical lookups iterate a tag's chain as a contiguous array instead of calling
+ * RequestDirectParent for every level. Must be rebuilt when the tag tree changes.
+ */
+class GAMPLAYTAGVALUE_API FTagValueAncestorTable
+{
+public:
+    /** Build the chains of all tags currently registered with the tag manager */
+    void Rebuild();
+    
+    /** Release the table */
+    void Reset();
+    
+    /** @return True if the table has been built */
+    bool IsBuilt() const { return !ChainOffsets.IsEmpty(); }
+    
+    /**
+     * Get the ancestor chain of a tag
+     * @param Tag The tag to look up
+     * @return The tag itself followed by its parents up to the root, or an empty view if the tag is not in the table
+     */
+    TArrayView<const FGameplayTag> GetChain(const FGameplayTag& Tag) const;
+    
+    /**
+     * Get the ancestor chain of a tag whose dense index is already known, without going through the tag manager
+     * @param Tag The tag to look up
+     * @param Index The tag's dense index, e.g. from an FTagValueIndexedTag
+     * @return The tag itself followed by its parents up to the root, or an empty view if the index does not hold the tag
+     */
+    TArrayView<const FGameplayTag> GetChain(const FGameplayTag& Tag, int32 Index) const;
+    
+    /**
+     * Get the dense indices of an ancestor chain
+     * @param Chain A chain returned by GetChain
+     * @return The indices of the tags in the chain, in the same order
+     */
+    TArrayView<const int32> GetChainIndices(TArrayView<const FGameplayTag> Chain) const;
+    
+    /**
+     * Get the dense indices of every descendant of a tag
+     * @param Tag The tag to look up
+     * @return The indices of all tags below the tag, in no particular order, or an empty view if the tag is not in the table
+     */
+    TArrayView<const int32> GetDescendants(const FGameplayTag& Tag) const;
+    
+    /**
+     * Get the tag stored at a dense index
+     * @param Index The dense index
+     * @return The tag, or an invalid tag if the index is not in the table
+     */
+    FGameplayTag GetTag(int32 Index) const;
+    
+    /** @return The number of dense indices covered by the table */
+    int32 Num() const { return FMath::Max(ChainOffsets.Num() - 1, 0); }
+
+private:
+    /** Start of each tag's chain in ChainTags, by dense index, plus a final end offset */
+    TArray<int32> ChainOffsets;
+    
+    /** All chains, back to back */
+    TArray<FGameplayTag> ChainTags;
+    
+    /** Dense index of every entry of ChainTags */
+    TArray<int32> ChainIndices;
+    
+    /** Start of each tag's descendant list in DescendantIndices, by dense index, plus a final end offset */
+    TArray<int32> DescendantOffsets;
+    
+    /** All descendant lists, back to back */
+    TArray<int32> DescendantIndices;
+};
+
+/**
+ * Direct parent of every registered tag, captured from the tag manager
+ * Built on the game thread and then only read, so a copy shared with worker threads lets them
+ * walk up the hierarchy without calling RequestDirectParent. Must be rebuilt when the tag tree changes.
+ */
+class GAMPLAYTAGVALUE_API FTagValueParentMap
+{
+public:
+    /** Capture the parents of all tags currently registered with the tag manager */
+    void Rebuild();
+    
+    /**
+     * Get the direct parent of a tag
+     * @param Tag The tag to look up
+     * @return The parent, or an invalid tag for root tags and tags that were not registered when the map was built
+     */
+    FGameplayTag GetParent(const FGameplayTag& Tag) const { return Parents.FindRef(Tag); }
+
+private:
+    /** Parent of every registered tag that has one */
+    TMap<FGameplayTag, FGameplayTag> Parents;
+};
+
+/**
+ * Compact record of which tags a repository holds values for, used to skip probes that are known to miss
+ * Holds one bit per dense tag index plus a summary of the root tags that have any value below them,
+ * so a whole repository can be skipped for unrelated subtrees. The filter never reports a false
+ * negative: after a tag tree change it answers "maybe" until it is rebuilt.
+ */
+class GAMPLAYTAGVALUE_API FTagValueMembershipFilter
+{
+public:
+    /** Record that a tag has a value; recording a tag twice has no effect */
+    void Add(const FGameplayTag& Tag);
+    
+    /** Record that a tag no longer has a value */
+    void Remove(const FGameplayTag& Tag);
+    
+    /**
+     * Replace the contents of the filter
+     * @param Tags Every tag that has a value
+     */
+    void Rebuild(TArrayView<const FGameplayTag> Tags);
+    
+    /** Forget all tags */
+    void Reset();
+    
+    /** @return True if the filter was built against an older tag tree and must be rebuilt */
+    bool IsStale() const { return TreeSerial != FTagValueTagIndex::GetTreeSerial(); }
+    
+    /**
+     * Test a tag by its dense index
+     * @param Index The dense index of the tag, or INDEX_NONE if unknown
+     * @return False if the tag definitely has no value
+     */
+    bool MayContain(int32 Index) const
+    {
+        if (bSaturated || Index == INDEX_NONE || IsStale())
+        {
+            return true;
+        }
+        return Index < Present.Num() && Present[Index];
+    }
+    
+    /**
+     * Test a whole subtree by the dense index of its root tag
+     * @param RootIndex The dense index of a root tag (a tag without parent), or INDEX_NONE if unknown
+     * @return False if no tag below the root, or the root itself, has a value
+     */
+    bool MayContainUnder(int32 RootIndex) const
+    {
+        if (bSaturated || RootIndex == INDEX_NONE || IsStale())
+        {
+            return true;
+        }
+        return RootIndex < RootPresent.Num() && RootPresent[RootIndex];
+    }
+
+private:
+    /** Get the dense index of the root tag above a tag */
+    static int32 GetRootIndex(const FGameplayTag& Tag);
+    
+    /** One bit per dense index, set when the tag has a value */
+    TBitArray<> Present;
+    
+    /** One bit per dense index of a root tag, set when any tag below it has a value */
+    TBitArray<> RootPresent;
+    
+    /** Number of recorded tags below each root, by the root's dense index */
+    TMap<int32, int32> RootCounts;
+    
+    /** Set when a tag without a dense index was recorded; the filter then answers "maybe" for everything */
+    bool bSaturated = false;
+    
+    /** Tree serial the indices were computed against */
+    uint32 TreeSerial = FTagValueTagIndex::GetTreeSerial();
+};
@@ -17,5 +17,59 @@ enum class ETagValueType : uint8
     String      UMETA(DisplayName = "String"),
     Transform   UMETA(DisplayName = "Transform"),
     Class       UMETA(DisplayName = "Class Reference"),
-    Object      UMETA(DisplayName = "Object Reference")
+    Object      UMETA(DisplayName = "Object Reference"),
+    
+    /** No value / unknown type, used as a type id only */
+    None        UMETA(Hidden)
+};
+
+/**
+ * Enum defining the storage backends available for in-memory tag value repositories
+ */
+UENUM(BlueprintType)
+enum class ETagValueRepositoryStorage : uint8
+{
+    /** Values stored in a map keyed by tag */
+    Map         UMETA(DisplayName = "Map"),
+    
+    /** Values stored in a flat array addressed by the tag's dense index */
+    Indexed     UMETA(DisplayName = "Indexed"),
+    
+    /** Values stored in per-type columns without per-value heap holders */
+    Columnar    UMETA(DisplayName = "Columnar"),
+    
+    /** Values stored in an immutable published snapshot that any thread can read without locking */
+    Snapshot    UMETA(DisplayName = "Snapshot"),
+    
+    /** Values partitioned into independently locked shards that many threads can read and write */
+    Sharded     UMETA(DisplayName = "Sharded"),
+    
+    /** Values in per-tag slots that any thread can read without locking, large values guarded by a sequence counter */
+    Versioned   UMETA(DisplayName = "Versioned")
+};
+
+/**
+ * Enum defining which tag changes a tag value subscription receives
+ */
+UENUM(BlueprintType)
+enum class ETagValueSubscriptionScope : uint8
+{
+    /** Only changes to the subscribed tag itself */
+    ExactTag            UMETA(DisplayName = "Exact Tag"),
+    
+    /** Changes to the subscribed tag and any of its descendants */
+    TagAndDescendants   UMETA(DisplayName = "Tag And Descendants")
+};
+
+/**
+ * Enum defining when the subsystem delivers tag value change notifications
+ */
+UENUM(BlueprintType)
+enum class ETagValueChangeDispatchMode : uint8
+{
+    /** Notify listeners synchronously on every write */
+    Immediate   UMETA(DisplayName = "Immediate"),
+    
+    /** Collect changes and notify once per tag at the end of the frame, with the final value */
+    EndOfFrame  UMETA(DisplayName = "End Of Frame")
 };
@@ -0,0 +1,104 @@
+// Copyright 2025 Nguyen Phi Hung. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TagValueBase.h"
+#include "TagValueInterface.h"
+#include "TagValueTypes.h"
+
+/**
+ * Value-semantic container for a single tag value
+ * Bool, int and float values are stored inline, so reading them needs no allocation,
+ * refcount or virtual call. Larger types are stored out of line by sharing the
+ * repository's value holder.
+ */
+class GAMPLAYTAGVALUE_API FTagValueVariant
+{
+public:
+    FTagValueVariant() : IntValue(0) {}
+    
+    /** Create a variant from a value holder, or an unset variant if the holder is invalid or of an unknown type */
+    static FTagValueVariant FromHolder(const TSharedPtr<ITagValueHolder>& Holder);
+    
+    /** Check if the variant holds a value */
+    bool IsSet() const { return TypeId != ETagValueType::None; }
+    
+    /** Get the type of the held value, or ETagValueType::None */
+    ETagValueType GetType() const { return TypeId; }
+    
+    /** Clear the held value */
+    void Reset()
+    {
+        TypeId = ETagValueType::None;
+        Boxed.Reset();
+    }
+    
+    /** Store an inline value */
+    void SetBool(bool InValue) { Reset(); TypeId = ETagValueType::Bool; BoolValue = InValue; }
+    void SetInt(int32 InValue) { Reset(); TypeId = ETagValueType::Int; IntValue = InValue; }
+    void SetFloat(float InValue) { Reset(); TypeId = ETagValueType::Float; FloatValue = InValue; }
+    
+    /** Store a larger value out of line, in a new holder */
+    template<typename TagValueType>
+    void SetBoxed(const typename TagValueType::ValueType& InValue)
+    {
+        Boxed = MakeShared<TTagValueHolder<TagValueType>>(TagValueType(InValue));
+        TypeId = TagValueType::StaticTypeId;
+    }
+    
+    /**
+     * Read the held value as a specific type
+     * @param OutValue Receives the value if the types match
+     * @return True if the variant holds a value of type T
+     */
+    template<typename T>
+    bool TryGet(T& OutValue) const
+    {
+        using TagValueType = typename TTagValueTraits<T>::TagValueType;
+        
+        if (TypeId != TTagValueTraits<T>::Type)
+        {
+            return false;
+        }
+        
+        if constexpr (std::is_same_v<T, bool>)
+        {
+            OutValue = BoolValue;
+        }
+        else if constexpr (std::is_same_v<T, int32>)
+        {
+            OutValue = IntValue;
+        }
+        else if constexpr (std::is_same_v<T, float>)
+        {
+            OutValue = FloatValue;
+        }
+        else
+        {
+            OutValue = static_cast<const TagValueType*>(Boxed->GetValuePtr())->Value;
+        }
+        return true;
+    }
+    
+    /**
+     * Convert to a value holder for the holder-based API
+     * Inline values are boxed into a new holder; out-of-line values return the shared holder.
+     */
+    TSharedPtr<ITagValueHolder> ToHolder() const;
+    
+private:
+    /** The type of the held value, or ETagValueType::None */
+    ETagValueType TypeId = ETagValueType::None;
+    
+    /** Inline storage for small values */
+    union
+    {
+        bool BoolValue;
+        int32 IntValue;
+        float FloatValue;
+    };
+    
+    /** Out-of-line storage for larger values */
+    TSharedPtr<ITagValueHolder> Boxed;
+};
@@ -0,0 +1,204 @@
+// Copyright 2025 Nguyen Phi Hung. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTags.h"
+#include "TagValueInterface.h"
+#include "TagValueReaderEpoch.h"
+#include "TagValueVariant.h"
+#include <atomic>
+
+/**
+ * Memory-based repository addressed by the tag's dense index whose reads never lock
+ * Each slot carries its value in a form that can be read without tearing:
+ * - bool, int and float values are packed with their type into one atomic word, read with a single load
+ * - transforms are guarded by a per-slot sequence counter; readers copy the transform and retry if a
+ *   writer touched the slot meanwhile (a seqlock)
+ * - strings, class and object references live in immutable holders that writers swap as a whole
+ * Writers are serialized by a lock. The slot table is sized for every registered tag up front and
+ * replaced as a whole when the tag tree changes, so slots never move under a reader. Each table captures
+ * the tag to slot map of its tree when it is built on the game thread, so readers find their slot in the
+ * table they loaded and never touch the tag manager or its lock.
+ *
+ * Replaced holders and tables are retired to an FTagValueReaderEpoch and freed once every reader that
+ * could have loaded them has left, so a reader that stalls for any length of time never sees freed memory.
+ */
+class GAMPLAYTAGVALUE_API FVersionedTagValueRepository : public ITagValueRepository
+{
+public:
+    FVersionedTagValueRepository(const FName& InName, int32 InPriority);
+    virtual ~FVersionedTagValueRepository();
+    
+    UE_NONCOPYABLE(FVersionedTagValueRepository);
+    
+    // ITagValueRepository interface; the read functions are safe to call from any thread
+    virtual bool HasValue(FGameplayTag Tag) const override;
+    virtual TSharedPtr<ITagValueHolder> GetValue(FGameplayTag Tag) const override;
+    virtual bool TryGetRaw(FGameplayTag Tag, FTagValueVariant& OutValue) const override;
+    virtual void SetValue(FGameplayTag Tag, TSharedPtr<ITagValueHolder> Value) override;
+    virtual void RemoveValue(FGameplayTag Tag) override;
+    virtual void ClearAllValues() override;
+    virtual TArray<FGameplayTag> GetAllTags() const override;
+    virtual FName GetRepositoryName() const override;
+    virtual int32 GetPriority() const override;
+    
+    /**
+     * Read a typed value without locking or allocating; safe to call from any thread
+     * The value is copied straight out of its slot, so no variant or holder is created on the way.
+     * @param Tag The tag to read
+     * @param OutValue Receives the value if found
+     * @return True if a value of type T is stored for the tag
+     */
+    template<typename T>
+    bool TryGetTypedValue(FGameplayTag Tag, T& OutValue) const
+    {
+        using TagValueType = typename TTagValueTraits<T>::TagValueType;
+        
+        const FTagValueReaderEpoch::FReadScope ReadScope(ReaderEpoch);
+        const FSlot* Slot = FindSlot(Tag);
+        if (!Slot)
+        {
+            return false;
+        }
+        
+        const uint64 Word = Slot->Word.load(std::memory_order_acquire);
+        if (GetWordType(Word) != TTagValueTraits<T>::Type)
+        {
+            return false;
+        }
+        
+        const uint32 Bits = static_cast<uint32>(Word);
+        if constexpr (std::is_same_v<T, bool>)
+        {
+            OutValue = Bits != 0;
+        }
+        else if constexpr (std::is_same_v<T, int32>)
+        {
+            OutValue = static_cast<int32>(Bits);
+        }
+        else if constexpr (std::is_same_v<T, float>)
+        {
+            FMemory::Memcpy(&OutValue, &Bits, sizeof(OutValue));
+        }
+        else if constexpr (std::is_same_v<T, FTransform>)
+        {
+            ReadTransform(*Slot, OutValue);
+        }
+        else
+        {
+            // The holder is swapped before the word, so it may already hold the next value's type
+            const ITagValueHolder* Holder = Slot->Boxed.load(std::memory_order_acquire);
+            if (!Holder || Holder->GetValueTypeId() != TTagValueTraits<T>::Type)
+            {
+                return false;
+            }
+            OutValue = static_cast<const TagValueType*>(const_cast<ITagValueHolder*>(Holder)->GetValuePtr())->Value;
+        }
+        return true;
+    }
+
+private:
+    /** A single addressable value slot */
+    struct FSlot
+    {
+        /** Type id plus one in the upper 32 bits (0 when empty), bool/int/float bits in the lower 32 */
+        std::atomic<uint64> Word{ 0 };
+        
+        /** Even while the transform is stable, odd while a writer is updating it */
+        std::atomic<uint32> Sequence{ 0 };
+        
+        /** Transform storage, allocated on the first transform write and kept for the table's lifetime */
+        std::atomic<FTransform*> Transform{ nullptr };
+        
+        /** Immutable holder of a string, class or object value */
+        std::atomic<const ITagValueHolder*> Boxed{ nullptr };
+    };
+    
+    /** Slots for every dense index of one version of the tag tree */
+    struct FSlotTable
+    {
+        /** Create a table with a slot for every dense index of the current tag tree */
+        FSlotTable();
+        ~FSlotTable();
+        
+        /** Number of slots */
+        int32 Num;
+        
+        /** The slots */
+        TUniquePtr<FSlot[]> Slots;
+        
+        /** Owners of the holders referenced by FSlot::Boxed; only touched by writers */
+        TArray<TSharedPtr<ITagValueHolder>> BoxedOwners;
+        
+        /** Tag that owns each slot in the tree the table was built for; never changes after construction */
+        TArray<FGameplayTag> SlotTags;
+        
+        /** Slot of each tag in the tree the table was built for; never changes after construction, so readers may look tags up in it */
+        TMap<FGameplayTag, int32> SlotIndices;
+    };
+    
+    /** Pack a type and small value bits into a slot word */
+    static uint64 MakeWord(ETagValueType Type, uint32 Bits)
+    {
+        return (static_cast<uint64>(Type) + 1) << 32 | Bits;
+    }
+    
+    /** Get the type stored in a slot word, or ETagValueType::None if empty */
+    static ETagValueType GetWordType(uint64 Word)
+    {
+        return Word ? static_cast<ETagValueType>((Word >> 32) - 1) : ETagValueType::None;
+    }
+    
+    /**
+     * Find the slot of a tag in the current table
+     * Readers must hold an FTagValueReaderEpoch::FReadScope for as long as they use the slot.
+     * @return The slot, or nullptr if the tag has no slot in the current table
+     */
+    const FSlot* FindSlot(const FGameplayTag& Tag) const;
+    
+    /** Find the index of a tag's slot in a table, or INDEX_NONE if the table has no slot for it; safe to call from any thread */
+    static int32 FindSlotIndex(const FSlotTable& InTable, const FGameplayTag& Tag);
+    
+    /** Read a slot without locking, retrying while a transform is being written */
+    static bool ReadSlot(const FSlot& Slot, FTagValueVariant& OutValue);
+    
+    /** Copy the transform of a slot with the seqlock read, retrying while a writer is updating it */
+    static void ReadTransform(const FSlot& Slot, FTransform& OutValue);
+    
+    /** Write a value into a slot; WriterLock must be held */
+    void WriteSlot(FSlotTable& InTable, int32 Index, const TSharedPtr<ITagValueHolder>& Value);
+    
+    /** Empty a slot; WriterLock must be held */
+    void ClearSlot(FSlotTable& InTable, int32 Index);
+    
+    /** Keep a replaced holder alive until no reader can still be using it; WriterLock must be held */
+    void RetireHolder(TSharedPtr<ITagValueHolder>&& Holder);
+    
+    /** Move the values into a table sized for the current tag tree */
+    void Reindex();
+    
+    /** Reclaim retired holders and tables at the end of the frame, when no write came along to do it */
+    void HandleEndFrame();
+    
+    /** The table readers use */
+    std::atomic<FSlotTable*> Table;
+    
+    /** Keeps replaced holders and tables alive for readers that may still be using them; retiring is guarded by WriterLock */
+    FTagValueReaderEpoch ReaderEpoch;
+    
+    /** Serializes writers */
+    mutable FCriticalSection WriterLock;
+    
+    /** Name of this repository */
+    FName RepositoryName;
+    
+    /** Priority of this repository */
+    int32 Priority;
+    
+    /** Handle for the tag tree changed delegate */
+    FDelegateHandle TagTreeChangedHandle;
+    
+    /** Handle for the end of frame delegate that reclaims retired holders and tables */
+    FDelegateHandle EndFrameHandle;
+};